@@ -15,6 +15,22 @@
 #include <cmath>
 #include <fstream>
 #include <sstream>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+#include <deque>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 // ===== UTILITY FUNCTIONS =====
 
@@ -159,11 +175,12 @@ std::vector<int> cloneVector(const std::vector<int> &vec)
     return std::vector<int>(vec);
 }
 
-// Track the number of comparisons and swaps
+// Track the number of comparisons and swaps (and which algorithm adaptiveSort picked)
 struct SortStatistics
 {
     size_t comparisons = 0;
     size_t swaps = 0;
+    std::string algorithm;
 };
 
 // For baseline comparison - insertion sort
@@ -188,6 +205,345 @@ void insertionSort(std::vector<int> &arr)
     }
 }
 
+// ===== SORTING NETWORK BASE CASES =====
+
+// The hybrid sorts below hand their small partitions to a base case. Instead of
+// insertion sort we can use a bitonic sorting network: a fixed sequence of
+// compare-exchange steps with no data-dependent branches, which maps directly
+// onto SIMD min/max instructions. One AVX2 register holds 8 int32/float lanes,
+// one AVX-512 register holds 16, so 64 elements fit in at most 8 registers.
+//
+// Compile with -mavx2 (or -mavx512f, or -march=native) to enable the vector
+// kernels. Without them the base case falls back to insertion sort.
+
+#if defined(__AVX512F__)
+#define SORTING_NETWORK_LANES 16
+#elif defined(__AVX2__)
+#define SORTING_NETWORK_LANES 8
+#endif
+
+// Largest range handled by a sorting network
+const int SORTING_NETWORK_MAX_SIZE = 64;
+
+#ifdef SORTING_NETWORK_LANES
+
+// Mask of lanes that keep the larger value in bitonic stage (k, j).
+// Lane i is paired with lane i ^ j and sorts ascending when (i & k) == 0.
+constexpr int bitonicMaxLaneMask(int lanes, int k, int j)
+{
+    int mask = 0;
+    for (int i = 0; i < lanes; i++)
+    {
+        bool upper = (i & j) != 0;
+        bool ascending = (i & k) == 0;
+        if (upper == ascending)
+        {
+            mask |= 1 << i;
+        }
+    }
+    return mask;
+}
+
+#if SORTING_NETWORK_LANES == 16
+
+// AVX-512 operations. The zero-masked forms with an all-ones mask compile to the
+// same instructions; GCC's unmasked forms use an uninitialized pass-through
+// register and trigger -Wmaybe-uninitialized.
+constexpr __mmask16 ALL_LANES = 0xFFFF;
+
+// AVX-512 operations on 16 x int32
+struct Int32Lanes
+{
+    using Value = int;
+    using Reg = __m512i;
+    static constexpr int lanes = 16;
+
+    static Reg load(const int *p) { return _mm512_loadu_si512(p); }
+    static void store(int *p, Reg v) { _mm512_storeu_si512(p, v); }
+    static Reg min(Reg a, Reg b) { return _mm512_maskz_min_epi32(ALL_LANES, a, b); }
+    static Reg max(Reg a, Reg b) { return _mm512_maskz_max_epi32(ALL_LANES, a, b); }
+    static Reg xorPermute(Reg v, int j)
+    {
+        const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        return _mm512_maskz_permutexvar_epi32(ALL_LANES, _mm512_xor_si512(lane, _mm512_set1_epi32(j)), v);
+    }
+    static Reg reverse(Reg v)
+    {
+        return _mm512_maskz_permutexvar_epi32(ALL_LANES, _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+    }
+    template <int mask>
+    static Reg blend(Reg lo, Reg hi) { return _mm512_mask_blend_epi32(static_cast<__mmask16>(mask), lo, hi); }
+    static Value sentinel() { return std::numeric_limits<int>::max(); }
+};
+
+// AVX-512 operations on 16 x float
+struct FloatLanes
+{
+    using Value = float;
+    using Reg = __m512;
+    static constexpr int lanes = 16;
+
+    static Reg load(const float *p) { return _mm512_loadu_ps(p); }
+    static void store(float *p, Reg v) { _mm512_storeu_ps(p, v); }
+    static Reg min(Reg a, Reg b) { return _mm512_maskz_min_ps(ALL_LANES, a, b); }
+    static Reg max(Reg a, Reg b) { return _mm512_maskz_max_ps(ALL_LANES, a, b); }
+    static Reg xorPermute(Reg v, int j)
+    {
+        const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        return _mm512_maskz_permutexvar_ps(ALL_LANES, _mm512_xor_si512(lane, _mm512_set1_epi32(j)), v);
+    }
+    static Reg reverse(Reg v)
+    {
+        return _mm512_maskz_permutexvar_ps(ALL_LANES, _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+    }
+    template <int mask>
+    static Reg blend(Reg lo, Reg hi) { return _mm512_mask_blend_ps(static_cast<__mmask16>(mask), lo, hi); }
+    static Value sentinel() { return std::numeric_limits<float>::infinity(); }
+};
+
+#else
+
+// AVX2 operations on 8 x int32
+struct Int32Lanes
+{
+    using Value = int;
+    using Reg = __m256i;
+    static constexpr int lanes = 8;
+
+    static Reg load(const int *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+    static void store(int *p, Reg v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_epi32(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_epi32(a, b); }
+    static Reg xorPermute(Reg v, int j)
+    {
+        const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        return _mm256_permutevar8x32_epi32(v, _mm256_xor_si256(lane, _mm256_set1_epi32(j)));
+    }
+    static Reg reverse(Reg v)
+    {
+        return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    }
+    template <int mask>
+    static Reg blend(Reg lo, Reg hi) { return _mm256_blend_epi32(lo, hi, mask); }
+    static Value sentinel() { return std::numeric_limits<int>::max(); }
+};
+
+// AVX2 operations on 8 x float
+struct FloatLanes
+{
+    using Value = float;
+    using Reg = __m256;
+    static constexpr int lanes = 8;
+
+    static Reg load(const float *p) { return _mm256_loadu_ps(p); }
+    static void store(float *p, Reg v) { _mm256_storeu_ps(p, v); }
+    static Reg min(Reg a, Reg b) { return _mm256_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) { return _mm256_max_ps(a, b); }
+    static Reg xorPermute(Reg v, int j)
+    {
+        const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        return _mm256_permutevar8x32_ps(v, _mm256_xor_si256(lane, _mm256_set1_epi32(j)));
+    }
+    static Reg reverse(Reg v)
+    {
+        return _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    }
+    template <int mask>
+    static Reg blend(Reg lo, Reg hi) { return _mm256_blend_ps(lo, hi, mask); }
+    static Value sentinel() { return std::numeric_limits<float>::infinity(); }
+};
+
+#endif
+
+// Bitonic sorting network over one or more SIMD registers
+template <typename Lanes>
+struct BitonicNetwork
+{
+    using Reg = typename Lanes::Reg;
+    static constexpr int W = Lanes::lanes;
+
+    // One compare-exchange stage inside a register
+    template <int K, int J>
+    static Reg stage(Reg v)
+    {
+        Reg partner = Lanes::xorPermute(v, J);
+        return Lanes::template blend<bitonicMaxLaneMask(W, K, J)>(Lanes::min(v, partner), Lanes::max(v, partner));
+    }
+
+    template <int K, int J>
+    static Reg sortStages(Reg v)
+    {
+        v = stage<K, J>(v);
+        if constexpr (J > 1)
+            return sortStages<K, J / 2>(v);
+        else if constexpr (K < W)
+            return sortStages<K * 2, K>(v);
+        else
+            return v;
+    }
+
+    template <int J>
+    static Reg mergeStages(Reg v)
+    {
+        // K = 2W makes every lane ascending, i.e. a plain bitonic merge
+        v = stage<2 * W, J>(v);
+        if constexpr (J > 1)
+            return mergeStages<J / 2>(v);
+        else
+            return v;
+    }
+
+    // Sort the lanes of a single register
+    static Reg sortRegister(Reg v) { return sortStages<2, 1>(v); }
+
+    // Sort a register that already holds a bitonic sequence
+    static Reg mergeRegister(Reg v) { return mergeStages<W / 2>(v); }
+
+    // Merge two sorted registers: afterwards lo holds the smallest W values
+    // and hi the largest W values, both sorted
+    static void mergeSortedRegisters(Reg &lo, Reg &hi)
+    {
+        Reg reversed = Lanes::reverse(hi);
+        Reg mn = Lanes::min(lo, reversed);
+        Reg mx = Lanes::max(lo, reversed);
+        lo = mergeRegister(mn);
+        hi = mergeRegister(mx);
+    }
+
+    // Sort count registers (1, 2, 4 or 8) as one sequence in register-major order
+    static void sortRegisters(Reg *regs, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            regs[i] = sortRegister(regs[i]);
+        }
+
+        // Merge sorted blocks of width registers pairwise
+        for (int width = 1; width < count; width *= 2)
+        {
+            for (int base = 0; base < count; base += 2 * width)
+            {
+                if (width == 1)
+                {
+                    mergeSortedRegisters(regs[base], regs[base + 1]);
+                    continue;
+                }
+
+                // Reverse the second block so the pair forms a bitonic sequence
+                for (int i = 0; i < width; i++)
+                {
+                    regs[base + width + i] = Lanes::reverse(regs[base + width + i]);
+                }
+                std::reverse(regs + base + width, regs + base + 2 * width);
+
+                // Half-cleaners across registers, then inside each register
+                for (int dist = width; dist >= 1; dist /= 2)
+                {
+                    for (int i = base; i < base + 2 * width; i++)
+                    {
+                        if (((i - base) & dist) == 0)
+                        {
+                            Reg mn = Lanes::min(regs[i], regs[i + dist]);
+                            Reg mx = Lanes::max(regs[i], regs[i + dist]);
+                            regs[i] = mn;
+                            regs[i + dist] = mx;
+                        }
+                    }
+                }
+                for (int i = base; i < base + 2 * width; i++)
+                {
+                    regs[i] = mergeRegister(regs[i]);
+                }
+            }
+        }
+    }
+
+    // Sort up to SORTING_NETWORK_MAX_SIZE values in place. The input is padded
+    // with sentinels up to the next network size (8/16/32/64 elements).
+    static void sort(typename Lanes::Value *data, int n)
+    {
+        using Value = typename Lanes::Value;
+
+        int count = 1;
+        while (count * W < n)
+        {
+            count *= 2;
+        }
+
+        Value buffer[SORTING_NETWORK_MAX_SIZE];
+        std::copy(data, data + n, buffer);
+        std::fill(buffer + n, buffer + count * W, Lanes::sentinel());
+
+        Reg regs[SORTING_NETWORK_MAX_SIZE / W];
+        for (int i = 0; i < count; i++)
+        {
+            regs[i] = Lanes::load(buffer + i * W);
+        }
+
+        sortRegisters(regs, count);
+
+        for (int i = 0; i < count; i++)
+        {
+            Lanes::store(buffer + i * W, regs[i]);
+        }
+        std::copy(buffer, buffer + n, data);
+    }
+};
+
+#endif // SORTING_NETWORK_LANES
+
+// Sort at most SORTING_NETWORK_MAX_SIZE ints with a sorting network
+// (std::sort when no SIMD kernel is compiled in)
+void sortingNetworkSort(int *data, int n)
+{
+#ifdef SORTING_NETWORK_LANES
+    BitonicNetwork<Int32Lanes>::sort(data, n);
+#else
+    std::sort(data, data + n);
+#endif
+}
+
+// Float version of the sorting network (input must not contain NaN)
+void sortingNetworkSort(float *data, int n)
+{
+#ifdef SORTING_NETWORK_LANES
+    BitonicNetwork<FloatLanes>::sort(data, n);
+#else
+    std::sort(data, data + n);
+#endif
+}
+
+// Base case shared by the hybrid sorts: sorts arr[left..right] inclusive.
+// useSortingNetwork = false gives the original insertion sort base case (used by the benchmark).
+void sortSmallRange(std::vector<int> &arr, int left, int right, bool useSortingNetwork = true)
+{
+    int n = right - left + 1;
+    if (n <= 1)
+        return;
+
+#ifdef SORTING_NETWORK_LANES
+    if (useSortingNetwork && n <= SORTING_NETWORK_MAX_SIZE)
+    {
+        sortingNetworkSort(arr.data() + left, n);
+        return;
+    }
+#endif
+
+    for (int i = left + 1; i <= right; i++)
+    {
+        int key = arr[i];
+        int j = i - 1;
+
+        while (j >= left && arr[j] > key)
+        {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+
+        arr[j + 1] = key;
+    }
+}
+
 // ===== MERGE SORT IMPLEMENTATIONS =====
 
 // Basic merge operation
@@ -336,41 +692,29 @@ void mergeSortWithStats(std::vector<int> &arr, SortStatistics &stats)
 }
 
 // Merge Sort with Insertion Sort for small arrays
-void hybridMergeSort(std::vector<int> &arr, int left, int right, int threshold = 10)
+void hybridMergeSort(std::vector<int> &arr, int left, int right, int threshold = 10, bool useSortingNetwork = true)
 {
     if (right - left <= threshold)
     {
-        // Use insertion sort for small arrays
-        for (int i = left + 1; i <= right; i++)
-        {
-            int key = arr[i];
-            int j = i - 1;
-
-            while (j >= left && arr[j] > key)
-            {
-                arr[j + 1] = arr[j];
-                j--;
-            }
-
-            arr[j + 1] = key;
-        }
+        // Use the small-array base case (sorting network or insertion sort)
+        sortSmallRange(arr, left, right, useSortingNetwork);
     }
     else
     {
         // Use merge sort for larger arrays
         int mid = left + (right - left) / 2;
 
-        hybridMergeSort(arr, left, mid, threshold);
-        hybridMergeSort(arr, mid + 1, right, threshold);
+        hybridMergeSort(arr, left, mid, threshold, useSortingNetwork);
+        hybridMergeSort(arr, mid + 1, right, threshold, useSortingNetwork);
 
         merge(arr, left, mid, right);
     }
 }
 
 // Wrapper function for Hybrid Merge Sort
-void hybridMergeSort(std::vector<int> &arr, int threshold = 10)
+void hybridMergeSort(std::vector<int> &arr, int threshold = 10, bool useSortingNetwork = true)
 {
-    hybridMergeSort(arr, 0, arr.size() - 1, threshold);
+    hybridMergeSort(arr, 0, arr.size() - 1, threshold, useSortingNetwork);
 }
 
 // Bottom-up (non-recursive) Merge Sort
@@ -718,26 +1062,14 @@ void threeWayQuickSort(std::vector<int> &arr)
 }
 
 // Hybrid Quick Sort (using Insertion Sort for small partitions)
-void hybridQuickSort(std::vector<int> &arr, int low, int high, int threshold = 10)
+void hybridQuickSort(std::vector<int> &arr, int low, int high, int threshold = 10, bool useSortingNetwork = true)
 {
     while (low < high)
     {
-        // Switch to insertion sort for small arrays
+        // Switch to the small-array base case (sorting network or insertion sort)
         if (high - low < threshold)
         {
-            for (int i = low + 1; i <= high; i++)
-            {
-                int key = arr[i];
-                int j = i - 1;
-
-                while (j >= low && arr[j] > key)
-                {
-                    arr[j + 1] = arr[j];
-                    j--;
-                }
-
-                arr[j + 1] = key;
-            }
+            sortSmallRange(arr, low, high, useSortingNetwork);
             break;
         }
         else
@@ -748,12 +1080,12 @@ void hybridQuickSort(std::vector<int> &arr, int low, int high, int threshold = 1
             // Tail call optimization: iterate on larger partition
             if (pi - low < high - pi)
             {
-                hybridQuickSort(arr, low, pi - 1, threshold);
+                hybridQuickSort(arr, low, pi - 1, threshold, useSortingNetwork);
                 low = pi + 1;
             }
             else
             {
-                hybridQuickSort(arr, pi + 1, high, threshold);
+                hybridQuickSort(arr, pi + 1, high, threshold, useSortingNetwork);
                 high = pi - 1;
             }
         }
@@ -761,9 +1093,9 @@ void hybridQuickSort(std::vector<int> &arr, int low, int high, int threshold = 1
 }
 
 // Wrapper function for Hybrid Quick Sort
-void hybridQuickSort(std::vector<int> &arr, int threshold = 10)
+void hybridQuickSort(std::vector<int> &arr, int threshold = 10, bool useSortingNetwork = true)
 {
-    hybridQuickSort(arr, 0, arr.size() - 1, threshold);
+    hybridQuickSort(arr, 0, arr.size() - 1, threshold, useSortingNetwork);
 }
 
 // Quick Select algorithm (to find kth smallest element)
@@ -1034,99 +1366,1350 @@ void merge(std::vector<int> &arr, int l, int m, int r)
         i++;
     }
 
-    while (j < len2)
+    while (j < len2)
+    {
+        arr[k] = right[j];
+        k++;
+        j++;
+    }
+}
+
+// Simplified Tim Sort implementation
+void timSort(std::vector<int> &arr, bool useSortingNetwork = true)
+{
+    int n = arr.size();
+    const int RUN = 32; // Size of sub-arrays to be sorted
+
+    // Sort individual sub-arrays of size RUN
+    for (int i = 0; i < n; i += RUN)
+    {
+        sortSmallRange(arr, i, std::min((i + RUN - 1), (n - 1)), useSortingNetwork);
+    }
+
+    // Start merging from size RUN (or 32)
+    for (int size = RUN; size < n; size = 2 * size)
+    {
+        for (int left = 0; left < n; left += 2 * size)
+        {
+            int mid = left + size - 1;
+            int right = std::min((left + 2 * size - 1), (n - 1));
+
+            // Skip the merge when the two runs are already in order
+            if (mid < right && arr[mid] > arr[mid + 1])
+            {
+                merge(arr, left, mid, right);
+            }
+        }
+    }
+}
+
+// ===== INTRO SORT IMPLEMENTATION =====
+
+// Calculate log base 2 of a number (used for IntroSort)
+int log2(int n)
+{
+    return (n > 1) ? 1 + log2(n / 2) : 0;
+}
+
+// IntroSort combines Quick Sort, Heap Sort, and Insertion Sort
+void introSort(std::vector<int> &arr, int begin, int end, int depthLimit, bool useSortingNetwork = true)
+{
+    // Size of the array
+    int size = end - begin;
+
+    // If the array is small, use the small-array base case
+    if (size < 16)
+    {
+        sortSmallRange(arr, begin, end - 1, useSortingNetwork);
+        return;
+    }
+
+    // If the recursion depth exceeds the limit, switch to heap sort
+    if (depthLimit == 0)
+    {
+        // Create a subvector for heap sort
+        std::vector<int> subArr(arr.begin() + begin, arr.begin() + end);
+        heapSort(subArr);
+
+        // Copy back to the original array
+        for (int i = 0; i < size; i++)
+        {
+            arr[begin + i] = subArr[i];
+        }
+
+        return;
+    }
+
+    // Use QuickSort with median-of-three pivot
+    int pivot = medianOfThree(arr, begin, end - 1);
+    std::swap(arr[pivot], arr[end - 1]);
+
+    int pi = partition(arr, begin, end - 1);
+
+    // Recursively sort the subarrays with reduced depth limit
+    introSort(arr, begin, pi, depthLimit - 1, useSortingNetwork);
+    introSort(arr, pi + 1, end, depthLimit - 1, useSortingNetwork);
+}
+
+// Wrapper function for IntroSort
+void introSort(std::vector<int> &arr, bool useSortingNetwork = true)
+{
+    if (arr.empty())
+        return;
+
+    // Set the depth limit as 2*log2(n)
+    int depthLimit = 2 * log2(arr.size());
+    introSort(arr, 0, arr.size(), depthLimit, useSortingNetwork);
+}
+
+// ===== PATTERN-DEFEATING QUICKSORT (PDQSORT) =====
+
+// pdqsort (Orson Peters) is introsort plus a few pattern detectors:
+// - ninther pivot selection on large ranges,
+// - a partition that reports whether the range was already partitioned, after which a
+//   bounded insertion sort finishes (nearly) sorted inputs in linear time,
+// - equal-key handling: if the pivot equals the element just before the range, all
+//   keys equal to it are split off in one pass,
+// - unbalanced partitions shuffle a few elements to break adversarial patterns and
+//   fall back to heap sort after log2(n) bad partitions.
+
+const int PDQ_INSERTION_SORT_THRESHOLD = 24;
+const int PDQ_NINTHER_THRESHOLD = 128;
+const int PDQ_PARTIAL_INSERTION_SORT_LIMIT = 8;
+
+// Sort three elements in place
+void pdqSort3(int *a, int *b, int *c)
+{
+    if (*b < *a)
+        std::swap(*a, *b);
+    if (*c < *b)
+        std::swap(*b, *c);
+    if (*b < *a)
+        std::swap(*a, *b);
+}
+
+// Plain insertion sort on [begin, end)
+void pdqInsertionSort(int *begin, int *end)
+{
+    for (int *cur = begin + 1; cur < end; ++cur)
+    {
+        int key = *cur;
+        int *sift = cur;
+        while (sift != begin && key < *(sift - 1))
+        {
+            *sift = *(sift - 1);
+            --sift;
+        }
+        *sift = key;
+    }
+}
+
+// Insertion sort that gives up after PDQ_PARTIAL_INSERTION_SORT_LIMIT moves.
+// Returns true if the range ended up sorted.
+bool pdqPartialInsertionSort(int *begin, int *end)
+{
+    if (begin == end)
+        return true;
+
+    size_t moves = 0;
+    for (int *cur = begin + 1; cur != end; ++cur)
+    {
+        if (*cur < *(cur - 1))
+        {
+            int key = *cur;
+            int *sift = cur;
+            do
+            {
+                *sift = *(sift - 1);
+                --sift;
+            } while (sift != begin && key < *(sift - 1));
+            *sift = key;
+            moves += cur - sift;
+        }
+
+        if (moves > PDQ_PARTIAL_INSERTION_SORT_LIMIT)
+            return false;
+    }
+
+    return true;
+}
+
+// Partition around *begin; elements equal to the pivot go right.
+// Returns the pivot position and whether no swaps were needed.
+std::pair<int *, bool> pdqPartitionRight(int *begin, int *end)
+{
+    int pivot = *begin;
+    int *first = begin;
+    int *last = end;
+
+    // The median-of-3 guarantees an element >= pivot before end, so the first scan is unguarded
+    while (*++first < pivot)
+        ;
+
+    if (first - 1 == begin)
+        while (first < last && !(*--last < pivot))
+            ;
+    else
+        while (!(*--last < pivot))
+            ;
+
+    bool alreadyPartitioned = first >= last;
+
+    while (first < last)
+    {
+        std::swap(*first, *last);
+        while (*++first < pivot)
+            ;
+        while (!(*--last < pivot))
+            ;
+    }
+
+    int *pivotPos = first - 1;
+    *begin = *pivotPos;
+    *pivotPos = pivot;
+    return {pivotPos, alreadyPartitioned};
+}
+
+// Partition around *begin; elements equal to the pivot go left.
+// Used when the pivot equals the element before the range, so everything <= pivot is done.
+int *pdqPartitionLeft(int *begin, int *end)
+{
+    int pivot = *begin;
+    int *first = begin;
+    int *last = end;
+
+    while (pivot < *--last)
+        ;
+
+    if (last + 1 == end)
+        while (first < last && !(pivot < *++first))
+            ;
+    else
+        while (!(pivot < *++first))
+            ;
+
+    while (first < last)
+    {
+        std::swap(*first, *last);
+        while (pivot < *--last)
+            ;
+        while (!(pivot < *++first))
+            ;
+    }
+
+    int *pivotPos = last;
+    *begin = *pivotPos;
+    *pivotPos = pivot;
+    return pivotPos;
+}
+
+// Main pdqsort loop: recurse on the left part, iterate on the right part
+void pdqSortLoop(int *begin, int *end, int badAllowed, bool leftmost, bool useSortingNetwork = true)
+{
+    while (true)
+    {
+        long size = end - begin;
+
+        if (size < PDQ_INSERTION_SORT_THRESHOLD)
+        {
+#ifdef SORTING_NETWORK_LANES
+            if (useSortingNetwork)
+            {
+                sortingNetworkSort(begin, static_cast<int>(size));
+                return;
+            }
+#endif
+            pdqInsertionSort(begin, end);
+            return;
+        }
+
+        // Pivot: median of 3, or pseudo-median of 9 for large ranges, moved to *begin
+        long half = size / 2;
+        if (size > PDQ_NINTHER_THRESHOLD)
+        {
+            pdqSort3(begin, begin + half, end - 1);
+            pdqSort3(begin + 1, begin + (half - 1), end - 2);
+            pdqSort3(begin + 2, begin + (half + 1), end - 3);
+            pdqSort3(begin + (half - 1), begin + half, begin + (half + 1));
+            std::swap(*begin, *(begin + half));
+        }
+        else
+        {
+            pdqSort3(begin + half, begin, end - 1);
+        }
+
+        // Pivot equal to the predecessor: split off the run of equal keys
+        if (!leftmost && !(*(begin - 1) < *begin))
+        {
+            begin = pdqPartitionLeft(begin, end) + 1;
+            continue;
+        }
+
+        auto partitionResult = pdqPartitionRight(begin, end);
+        int *pivotPos = partitionResult.first;
+        bool alreadyPartitioned = partitionResult.second;
+
+        long leftSize = pivotPos - begin;
+        long rightSize = end - (pivotPos + 1);
+        bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+        if (highlyUnbalanced)
+        {
+            // Too many bad pivots: guarantee O(n log n) with heap sort
+            if (--badAllowed == 0)
+            {
+                std::make_heap(begin, end);
+                std::sort_heap(begin, end);
+                return;
+            }
+
+            // Break patterns by swapping a few elements into new positions
+            if (leftSize >= PDQ_INSERTION_SORT_THRESHOLD)
+            {
+                std::swap(begin[0], begin[leftSize / 4]);
+                std::swap(pivotPos[-1], pivotPos[-leftSize / 4]);
+
+                if (leftSize > PDQ_NINTHER_THRESHOLD)
+                {
+                    std::swap(begin[1], begin[leftSize / 4 + 1]);
+                    std::swap(begin[2], begin[leftSize / 4 + 2]);
+                    std::swap(pivotPos[-2], pivotPos[-(leftSize / 4 + 1)]);
+                    std::swap(pivotPos[-3], pivotPos[-(leftSize / 4 + 2)]);
+                }
+            }
+
+            if (rightSize >= PDQ_INSERTION_SORT_THRESHOLD)
+            {
+                std::swap(pivotPos[1], pivotPos[1 + rightSize / 4]);
+                std::swap(end[-1], end[-rightSize / 4]);
+
+                if (rightSize > PDQ_NINTHER_THRESHOLD)
+                {
+                    std::swap(pivotPos[2], pivotPos[2 + rightSize / 4]);
+                    std::swap(pivotPos[3], pivotPos[3 + rightSize / 4]);
+                    std::swap(end[-2], end[-(1 + rightSize / 4)]);
+                    std::swap(end[-3], end[-(2 + rightSize / 4)]);
+                }
+            }
+        }
+        else if (alreadyPartitioned &&
+                 pdqPartialInsertionSort(begin, pivotPos) &&
+                 pdqPartialInsertionSort(pivotPos + 1, end))
+        {
+            // The range was (nearly) sorted already
+            return;
+        }
+
+        pdqSortLoop(begin, pivotPos, badAllowed, leftmost, useSortingNetwork);
+        begin = pivotPos + 1;
+        leftmost = false;
+    }
+}
+
+// Wrapper function for pdqsort
+void pdqSort(std::vector<int> &arr, bool useSortingNetwork = true)
+{
+    if (arr.size() <= 1)
+        return;
+
+    int badAllowed = 0;
+    for (size_t n = arr.size(); n > 1; n >>= 1)
+    {
+        badAllowed++;
+    }
+
+    pdqSortLoop(arr.data(), arr.data() + arr.size(), badAllowed, true, useSortingNetwork);
+}
+
+// ===== LSD RADIX SORT =====
+
+// LSD radix sort on integers, 8 bits per pass. Keys are offset by the minimum so only
+// the bytes that actually vary across (max - min) need a pass.
+void radixSort(std::vector<int> &arr)
+{
+    size_t n = arr.size();
+    if (n <= 1)
+        return;
+
+    auto bounds = std::minmax_element(arr.begin(), arr.end());
+    int64_t minValue = *bounds.first;
+    uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(*bounds.second) - minValue);
+
+    std::vector<uint32_t> keys(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        keys[i] = static_cast<uint32_t>(static_cast<int64_t>(arr[i]) - minValue);
+    }
+
+    std::vector<uint32_t> buffer(n);
+    for (int shift = 0; shift < 32 && (range >> shift) != 0; shift += 8)
+    {
+        size_t count[256] = {0};
+        for (uint32_t key : keys)
+        {
+            count[(key >> shift) & 0xFF]++;
+        }
+
+        size_t offset = 0;
+        for (size_t &c : count)
+        {
+            size_t digitCount = c;
+            c = offset;
+            offset += digitCount;
+        }
+
+        for (uint32_t key : keys)
+        {
+            buffer[count[(key >> shift) & 0xFF]++] = key;
+        }
+        keys.swap(buffer);
+    }
+
+    for (size_t i = 0; i < n; i++)
+    {
+        arr[i] = static_cast<int>(static_cast<int64_t>(keys[i]) + minValue);
+    }
+}
+
+// ===== ADAPTIVE SORTING FRONT-END =====
+
+// Cheap, sample-based description of an input used to pick a sorting algorithm
+struct PresortednessProfile
+{
+    size_t size = 0;
+    double descentRatio = 0;   // fraction of adjacent pairs out of order (~ runs / n)
+    double inversionRatio = 0; // sampled inversions / sampled pairs (0 sorted, 0.5 random, 1 reversed)
+    double duplicateRatio = 0; // 1 - distinct / sample size
+    int64_t keyRange = 0;      // max - min of the sample
+};
+
+// Estimate runs, inversions, duplicates and key range in O(sample^2) time for
+// inversions and O(sample) otherwise, independent of n for large inputs
+PresortednessProfile measurePresortedness(const std::vector<int> &arr)
+{
+    PresortednessProfile profile;
+    size_t n = arr.size();
+    profile.size = n;
+    if (n < 2)
+        return profile;
+
+    // Descents: full scan for small inputs, otherwise 64 evenly spaced windows of 64
+    size_t descents = 0;
+    size_t pairs = 0;
+    const size_t windows = 64;
+    const size_t windowSize = 64;
+    if (n <= windows * windowSize)
+    {
+        for (size_t i = 1; i < n; i++)
+        {
+            descents += arr[i] < arr[i - 1];
+        }
+        pairs = n - 1;
+    }
+    else
+    {
+        for (size_t w = 0; w < windows; w++)
+        {
+            size_t start = w * (n - windowSize) / (windows - 1);
+            for (size_t i = start + 1; i < start + windowSize; i++)
+            {
+                descents += arr[i] < arr[i - 1];
+            }
+            pairs += windowSize - 1;
+        }
+    }
+    profile.descentRatio = static_cast<double>(descents) / pairs;
+
+    // Inversions among an order-preserving, evenly spaced sample
+    size_t inversionSample = std::min<size_t>(n, 256);
+    std::vector<int> sample(inversionSample);
+    for (size_t i = 0; i < inversionSample; i++)
+    {
+        sample[i] = arr[i * n / inversionSample];
+    }
+    size_t inversions = 0;
+    for (size_t i = 0; i < inversionSample; i++)
+    {
+        for (size_t j = i + 1; j < inversionSample; j++)
+        {
+            inversions += sample[j] < sample[i];
+        }
+    }
+    profile.inversionRatio = static_cast<double>(inversions) / (inversionSample * (inversionSample - 1) / 2);
+
+    // Duplicates and key range from a larger pseudo-random sample
+    size_t valueSample = std::min<size_t>(n, 1024);
+    std::vector<int> values(valueSample);
+    std::mt19937 gen(static_cast<unsigned>(n));
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    for (size_t i = 0; i < valueSample; i++)
+    {
+        values[i] = valueSample == n ? arr[i] : arr[pick(gen)];
+    }
+    std::sort(values.begin(), values.end());
+    size_t distinct = std::unique(values.begin(), values.end()) - values.begin();
+    profile.duplicateRatio = 1.0 - static_cast<double>(distinct) / valueSample;
+    profile.keyRange = static_cast<int64_t>(values[distinct - 1]) - values[0];
+
+    return profile;
+}
+
+// Pick a sorting algorithm from the input's profile, run it, and record the choice
+// in stats.algorithm
+void adaptiveSort(std::vector<int> &arr, SortStatistics &stats)
+{
+    size_t n = arr.size();
+    if (n < 64)
+    {
+        stats.algorithm = "Small-Array Base Case";
+        if (n > 1)
+            sortSmallRange(arr, 0, static_cast<int>(n) - 1);
+        return;
+    }
+
+    PresortednessProfile profile = measurePresortedness(arr);
+
+    if (profile.descentRatio <= 0.001)
+    {
+        // A few long ascending runs: Tim Sort skips merges of runs already in order
+        stats.algorithm = "Tim Sort";
+        timSort(arr);
+    }
+    else if (profile.inversionRatio >= 0.98)
+    {
+        // Descending input: reverse it, pdqsort then finishes it in near-linear time
+        stats.algorithm = "Reverse + pdqsort";
+        std::reverse(arr.begin(), arr.end());
+        pdqSort(arr);
+    }
+    else if (profile.inversionRatio <= 0.05)
+    {
+        // Nearly sorted: pdqsort detects already partitioned ranges
+        stats.algorithm = "pdqsort";
+        pdqSort(arr);
+    }
+    else if (profile.keyRange < static_cast<int64_t>(n) * 4 ||
+             (n >= 2048 && profile.duplicateRatio < 0.5))
+    {
+        // Random keys: at most 4 linear passes beat O(n log n) comparisons
+        stats.algorithm = "Radix Sort";
+        radixSort(arr);
+    }
+    else
+    {
+        // Small inputs, or few distinct keys over a wide range (pdqsort splits off
+        // runs of equal keys, which measured faster than three-way quick sort here)
+        stats.algorithm = "pdqsort";
+        pdqSort(arr);
+    }
+}
+
+// Wrapper function for the adaptive sort
+void adaptiveSort(std::vector<int> &arr)
+{
+    SortStatistics stats;
+    adaptiveSort(arr, stats);
+}
+
+// ===== KEY-INDEX SORTING FOR LARGE RECORDS =====
+
+// Sorting large records (strings, payload buffers) directly means every swap
+// moves whole records. Key-index sorting instead:
+//   1. extracts a compact (key, index) pair per record,
+//   2. sorts those pairs (LSD radix sort on a normalized 64-bit key),
+//   3. moves each record once into its final slot by following permutation cycles.
+// Arithmetic keys are normalized so that unsigned comparison of the 64-bit key
+// matches the original order. String keys use their first 8 bytes as the radix
+// key and fall back to a full comparison only among equal prefixes.
+
+// Compact key plus the record position it came from
+struct KeyIndex
+{
+    uint64_t key;
+    uint32_t index;
+};
+
+// Map an arithmetic value to a uint64_t whose unsigned order matches the value order
+template <typename K>
+uint64_t normalizeKey(K value)
+{
+    static_assert(std::is_arithmetic<K>::value, "normalizeKey needs an arithmetic key");
+
+    if constexpr (std::is_floating_point<K>::value)
+    {
+        // IEEE-754: flip all bits of negatives, flip only the sign bit of positives
+        double d = static_cast<double>(value);
+        uint64_t bits;
+        std::memcpy(&bits, &d, sizeof(bits));
+        return (bits & (1ULL << 63)) ? ~bits : (bits | (1ULL << 63));
+    }
+    else if constexpr (std::is_signed<K>::value)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (1ULL << 63);
+    }
+    else
+    {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+// First 8 bytes of a string packed big-endian, so integer order matches lexicographic order
+uint64_t normalizedStringPrefix(const std::string &s)
+{
+    uint64_t prefix = 0;
+    size_t len = std::min<size_t>(s.size(), 8);
+    for (size_t i = 0; i < 8; i++)
+    {
+        prefix <<= 8;
+        if (i < len)
+        {
+            prefix |= static_cast<unsigned char>(s[i]);
+        }
+    }
+    return prefix;
+}
+
+// Stable LSD radix sort of (key, index) pairs, 8 bits per pass.
+// Passes where every key has the same digit are skipped.
+void radixSortKeyIndex(std::vector<KeyIndex> &items)
+{
+    const int passes = 8;
+    size_t n = items.size();
+    if (n <= 1)
+        return;
+
+    // Histogram all digits in one sweep
+    std::vector<std::array<size_t, 256>> counts(passes);
+    for (auto &count : counts)
+    {
+        count.fill(0);
+    }
+    for (const auto &item : items)
+    {
+        for (int pass = 0; pass < passes; pass++)
+        {
+            counts[pass][(item.key >> (8 * pass)) & 0xFF]++;
+        }
+    }
+
+    std::vector<KeyIndex> buffer(n);
+    for (int pass = 0; pass < passes; pass++)
+    {
+        int shift = 8 * pass;
+        auto &count = counts[pass];
+
+        if (count[(items[0].key >> shift) & 0xFF] == n)
+        {
+            continue;
+        }
+
+        // Exclusive prefix sums give the first output slot for each digit
+        size_t offset = 0;
+        for (size_t &c : count)
+        {
+            size_t digitCount = c;
+            c = offset;
+            offset += digitCount;
+        }
+
+        for (const auto &item : items)
+        {
+            buffer[count[(item.key >> shift) & 0xFF]++] = item;
+        }
+        items.swap(buffer);
+    }
+}
+
+// Rearrange records so that the record at position i becomes the old records[order[i]].
+// Every record is moved exactly once, plus one temporary per permutation cycle.
+// The order vector is consumed (reset to the identity).
+template <typename T>
+void applyPermutationInPlace(std::vector<T> &records, std::vector<uint32_t> &order)
+{
+    for (uint32_t start = 0; start < order.size(); start++)
+    {
+        if (order[start] == start)
+            continue;
+
+        T temp = std::move(records[start]);
+        uint32_t current = start;
+
+        while (order[current] != start)
+        {
+            uint32_t next = order[current];
+            records[current] = std::move(records[next]);
+            order[current] = current;
+            current = next;
+        }
+
+        records[current] = std::move(temp);
+        order[current] = current;
+    }
+}
+
+// Sort records by an extracted key without swapping the records themselves.
+// keyOf(record) may return any arithmetic type or a std::string. The sort is stable.
+template <typename T, typename KeyFn>
+void keyIndexSort(std::vector<T> &records, KeyFn keyOf, bool descending = false)
+{
+    using Key = typename std::decay<decltype(keyOf(records[0]))>::type;
+
+    size_t n = records.size();
+    if (n <= 1)
+        return;
+
+    std::vector<KeyIndex> items(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        uint64_t key;
+        if constexpr (std::is_same<Key, std::string>::value)
+            key = normalizedStringPrefix(keyOf(records[i]));
+        else
+            key = normalizeKey(keyOf(records[i]));
+
+        // Inverting the key reverses the order but keeps ties in input order
+        items[i] = {descending ? ~key : key, static_cast<uint32_t>(i)};
+    }
+
+    radixSortKeyIndex(items);
+
+    if constexpr (std::is_same<Key, std::string>::value)
+    {
+        // Equal prefixes only tell us the first 8 bytes match; finish with full comparisons
+        size_t runStart = 0;
+        while (runStart < n)
+        {
+            size_t runEnd = runStart + 1;
+            while (runEnd < n && items[runEnd].key == items[runStart].key)
+            {
+                runEnd++;
+            }
+
+            if (runEnd - runStart > 1)
+            {
+                std::stable_sort(items.begin() + runStart, items.begin() + runEnd,
+                                 [&records, &keyOf, descending](const KeyIndex &a, const KeyIndex &b)
+                                 {
+                                     const std::string &keyA = keyOf(records[a.index]);
+                                     const std::string &keyB = keyOf(records[b.index]);
+                                     return descending ? keyB < keyA : keyA < keyB;
+                                 });
+            }
+
+            runStart = runEnd;
+        }
+    }
+
+    std::vector<uint32_t> order(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        order[i] = items[i].index;
+    }
+
+    applyPermutationInPlace(records, order);
+}
+
+// ===== PARALLEL SAMPLE SORT (IPS4o-STYLE) =====
+
+// In-place parallel samplesort after IPS4o (Axtmann, Witt, Ferizovic, Sanders):
+//   1. Oversample and pick k-1 splitters; store them as an implicit search tree so
+//      classification is a branch-free loop of log2(k) comparisons.
+//   2. Each thread classifies its stripe into per-bucket buffers of one block and
+//      flushes full blocks back into its own stripe (so no extra array is needed).
+//   3. Full blocks are permuted in parallel into their bucket regions using an
+//      atomic-ish write/read pointer pair per bucket.
+//   4. A cleanup pass writes the partially filled buffers into the bucket gaps.
+// Buckets are then sorted recursively as tasks on a work-stealing scheduler.
+// Worker threads are pinned to CPUs in NUMA node order on Linux, so neighbouring
+// stripes are handled by threads that share a memory node.
+
+const size_t SAMPLE_SORT_BLOCK_SIZE = 256;        // elements per block
+const int SAMPLE_SORT_MAX_BUCKETS = 256;          // power of two
+const size_t SAMPLE_SORT_BASE_CASE = 1 << 14;     // buckets below this use std::sort
+
+// CPU ids listed node by node (from /sys/devices/system/node) restricted to the CPUs
+// this process may run on. Falls back to 0..hardware_concurrency-1.
+std::vector<int> numaOrderedCpus()
+{
+    std::vector<int> cpus;
+
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool haveMask = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    for (int node = 0;; node++)
+    {
+        std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!in)
+            break;
+
+        // Format: "0-3,8-11"
+        std::string list;
+        std::getline(in, list);
+        std::stringstream ss(list);
+        std::string range;
+        while (std::getline(ss, range, ','))
+        {
+            if (range.empty())
+                continue;
+            size_t dash = range.find('-');
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                if (!haveMask || CPU_ISSET(cpu, &allowed))
+                    cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+
+    if (cpus.empty())
+    {
+        int hw = std::max(1u, std::thread::hardware_concurrency());
+        for (int cpu = 0; cpu < hw; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+
+    return cpus;
+}
+
+// Pin a thread to one CPU (no-op where thread affinity is not available)
+void pinThreadToCpu(std::thread &thread, int cpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+    (void)thread;
+    (void)cpu;
+#endif
+}
+
+// Run work(t) for t = 0..numThreads-1 on pinned threads (inline for a single thread)
+void runPinnedThreads(int numThreads, const std::function<void(int)> &work)
+{
+    if (numThreads <= 1)
+    {
+        work(0);
+        return;
+    }
+
+    static const std::vector<int> cpus = numaOrderedCpus();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back(work, t);
+        pinThreadToCpu(threads.back(), cpus[t % cpus.size()]);
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Splitters stored as an implicit binary search tree (tree[1] is the root)
+struct SampleSortClassifier
+{
+    int numBuckets = 0;
+    int logBuckets = 0;
+    std::vector<int> tree;
+
+    void build(const std::vector<int> &splitters, int node, int lo, int hi)
+    {
+        if (lo > hi)
+            return;
+        int mid = lo + (hi - lo) / 2;
+        tree[node] = splitters[mid];
+        build(splitters, 2 * node, lo, mid - 1);
+        build(splitters, 2 * node + 1, mid + 1, hi);
+    }
+
+    // splitters must be sorted and hold exactly numBuckets - 1 values
+    void init(const std::vector<int> &splitters, int buckets)
+    {
+        numBuckets = buckets;
+        logBuckets = 0;
+        while ((1 << logBuckets) < buckets)
+        {
+            logBuckets++;
+        }
+        tree.assign(buckets, 0);
+        build(splitters, 1, 0, buckets - 2);
+    }
+
+    // Bucket j holds splitter[j-1] < x <= splitter[j]; no data-dependent branches
+    int bucketOf(int x) const
+    {
+        size_t i = 1;
+        for (int level = 0; level < logBuckets; level++)
+        {
+            i = 2 * i + (tree[i] < x);
+        }
+        return static_cast<int>(i) - numBuckets;
+    }
+
+    // Classify a batch of elements; independent elements keep the pipeline busy
+    void classify(const int *values, int count, int *buckets) const
+    {
+        for (int j = 0; j < count; j++)
+        {
+            buckets[j] = 1;
+        }
+        for (int level = 0; level < logBuckets; level++)
+        {
+            for (int j = 0; j < count; j++)
+            {
+                buckets[j] = 2 * buckets[j] + (tree[buckets[j]] < values[j]);
+            }
+        }
+        for (int j = 0; j < count; j++)
+        {
+            buckets[j] -= numBuckets;
+        }
+    }
+};
+
+// Per-thread state of the local classification phase
+struct SampleSortThreadState
+{
+    std::vector<int> buffers;      // numBuckets blocks
+    std::vector<size_t> fill;      // elements in each buffer
+    std::vector<size_t> counts;    // elements of each bucket seen by this thread
+    size_t stripeBegin = 0;
+    size_t stripeEnd = 0;
+    size_t fullEnd = 0;            // stripe holds full blocks in [stripeBegin, fullEnd)
+};
+
+// Write and read pointers of one bucket during block permutation
+struct SampleSortBucketPointers
+{
+    std::mutex lock;
+    size_t write = 0;                 // next slot to fill
+    size_t read = 0;                  // unprocessed blocks are in [write, read)
+    std::atomic<int> pendingReads{0}; // blocks taken but not yet copied out
+};
+
+// One in-place samplesort partitioning step on data[0..n). Returns the first index of
+// each bucket plus n at the end, or an empty vector if no progress was made (the data
+// is then still a permutation of the input and should be sorted another way).
+std::vector<size_t> sampleSortPartition(int *data, size_t n, int numThreads)
+{
+    const size_t B = SAMPLE_SORT_BLOCK_SIZE;
+
+    // ---- 1. Sampling ----
+    int numBuckets = 2;
+    while (numBuckets < SAMPLE_SORT_MAX_BUCKETS && static_cast<size_t>(numBuckets) * 2 * B <= n / 2)
+    {
+        numBuckets *= 2;
+    }
+
+    size_t oversampling = std::max<size_t>(1, static_cast<size_t>(0.2 * std::log2(static_cast<double>(n))));
+    size_t sampleSize = std::min(n, oversampling * numBuckets);
+    std::vector<int> sample(sampleSize);
+    std::mt19937_64 gen(n);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    for (auto &value : sample)
+    {
+        value = data[pick(gen)];
+    }
+    std::sort(sample.begin(), sample.end());
+
+    std::vector<int> splitters;
+    for (int j = 1; j < numBuckets; j++)
+    {
+        int splitter = sample[j * sampleSize / numBuckets - 1];
+        if (splitters.empty() || splitters.back() < splitter)
+            splitters.push_back(splitter);
+    }
+    if (splitters.empty() || sample.front() == sample.back())
+    {
+        return {};
+    }
+    // Duplicate splitters were dropped; pad with the largest so trailing buckets stay empty
+    splitters.resize(numBuckets - 1, splitters.back());
+
+    SampleSortClassifier classifier;
+    classifier.init(splitters, numBuckets);
+
+    // ---- 2. Local classification into block buffers ----
+    size_t stripeSize = ((n + numThreads - 1) / numThreads + B - 1) / B * B;
+    numThreads = static_cast<int>((n + stripeSize - 1) / stripeSize);
+    std::vector<SampleSortThreadState> states(numThreads);
+
+    runPinnedThreads(numThreads, [&](int t)
+                     {
+        SampleSortThreadState &state = states[t];
+        state.buffers.resize(numBuckets * B);
+        state.fill.assign(numBuckets, 0);
+        state.counts.assign(numBuckets, 0);
+        state.stripeBegin = t * stripeSize;
+        state.stripeEnd = std::min(n, state.stripeBegin + stripeSize);
+
+        size_t write = state.stripeBegin;
+        const int batch = 16;
+        int buckets[batch];
+        int values[batch];
+
+        for (size_t i = state.stripeBegin; i < state.stripeEnd; i += batch)
+        {
+            int count = static_cast<int>(std::min<size_t>(batch, state.stripeEnd - i));
+            std::copy(data + i, data + i + count, values);
+            classifier.classify(values, count, buckets);
+
+            for (int j = 0; j < count; j++)
+            {
+                int b = buckets[j];
+                if (state.fill[b] == B)
+                {
+                    // Everything before i + j has been read, so this never overtakes the reader
+                    std::copy(state.buffers.begin() + b * B, state.buffers.begin() + (b + 1) * B, data + write);
+                    write += B;
+                    state.fill[b] = 0;
+                }
+                state.buffers[b * B + state.fill[b]++] = values[j];
+                state.counts[b]++;
+            }
+        }
+
+        state.fullEnd = write; });
+
+    // ---- Bucket boundaries: bucket b owns [bucketStart[b], bucketStart[b + 1]) ----
+    std::vector<size_t> bucketStart(numBuckets + 1, 0);
+    for (int b = 0; b < numBuckets; b++)
+    {
+        size_t total = 0;
+        for (const auto &state : states)
+        {
+            total += state.counts[b];
+        }
+        bucketStart[b + 1] = bucketStart[b] + total;
+    }
+
+    // Block-aligned regions where full blocks of each bucket are placed
+    std::vector<size_t> regionStart(numBuckets + 1);
+    for (int b = 0; b < numBuckets; b++)
+    {
+        regionStart[b] = std::min((bucketStart[b] + B - 1) / B * B, n);
+    }
+    regionStart[numBuckets] = n;
+
+    auto isFullSlot = [&](size_t slot)
+    {
+        const SampleSortThreadState &state = states[slot / stripeSize];
+        return slot < state.fullEnd;
+    };
+
+    // ---- 3a. Move full blocks to the front of every region (regions are independent) ----
+    std::vector<SampleSortBucketPointers> pointers(numBuckets);
+    std::atomic<int> nextRegion{0};
+
+    runPinnedThreads(numThreads, [&](int)
+                     {
+        for (int b = nextRegion++; b < numBuckets; b = nextRegion++)
+        {
+            size_t lo = regionStart[b];
+            size_t hi = regionStart[b + 1];
+
+            std::vector<size_t> slots;
+            for (size_t slot = lo; slot + B <= hi; slot += B)
+            {
+                slots.push_back(slot);
+            }
+
+            // Two pointers: first empty slot from the front, last full slot from the back
+            size_t front = 0;
+            size_t back = slots.size();
+            while (true)
+            {
+                while (front < back && isFullSlot(slots[front]))
+                    front++;
+                while (back > front && !isFullSlot(slots[back - 1]))
+                    back--;
+                if (front >= back)
+                    break;
+
+                std::copy(data + slots[back - 1], data + slots[back - 1] + B, data + slots[front]);
+                front++;
+                back--;
+            }
+
+            size_t fullBlocks = front;
+            pointers[b].write = lo;
+            pointers[b].read = lo + fullBlocks * B;
+        } });
+
+    // ---- 3b. Block permutation ----
+    std::vector<int> overflowBlock(B);
+    size_t overflowSlot = std::numeric_limits<size_t>::max(); // slot parked in overflowBlock
+
+    runPinnedThreads(numThreads, [&](int t)
+                     {
+        std::vector<int> current(B);
+        std::vector<int> evicted(B);
+
+        int b = static_cast<int>(static_cast<long long>(t) * numBuckets / numThreads);
+        for (int step = 0; step < numBuckets; step++, b = (b + 1) % numBuckets)
+        {
+            while (true)
+            {
+                // Take an unprocessed block from the read end of bucket b
+                size_t pos;
+                {
+                    std::lock_guard<std::mutex> guard(pointers[b].lock);
+                    if (pointers[b].read <= pointers[b].write)
+                        break;
+                    pointers[b].read -= B;
+                    pos = pointers[b].read;
+                    pointers[b].pendingReads++;
+                }
+                std::copy(data + pos, data + pos + B, current.begin());
+                pointers[b].pendingReads--;
+
+                // Follow the chain of displaced blocks until one lands in an empty slot
+                while (true)
+                {
+                    int dest = classifier.bucketOf(current[0]);
+                    size_t slot;
+                    bool occupied;
+                    {
+                        std::lock_guard<std::mutex> guard(pointers[dest].lock);
+                        slot = pointers[dest].write;
+                        pointers[dest].write += B;
+                        occupied = slot < pointers[dest].read;
+                    }
+
+                    if (occupied)
+                    {
+                        std::copy(data + slot, data + slot + B, evicted.begin());
+                        std::copy(current.begin(), current.end(), data + slot);
+                        current.swap(evicted);
+                        continue;
+                    }
+
+                    // The slot may still be being copied out by the thread that took it
+                    while (pointers[dest].pendingReads.load() > 0)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    if (slot + B > n)
+                    {
+                        std::copy(current.begin(), current.end(), overflowBlock.begin());
+                        overflowSlot = slot;
+                    }
+                    else
+                    {
+                        std::copy(current.begin(), current.end(), data + slot);
+                    }
+                    break;
+                }
+            }
+        } });
+
+    // ---- 4. Cleanup ----
+    // Save the part of each bucket's last block that spills past the bucket end
+    std::vector<std::vector<int>> spill(numBuckets);
+    for (int b = 0; b < numBuckets; b++)
+    {
+        size_t end = bucketStart[b + 1];
+        size_t written = pointers[b].write;
+        if (written <= regionStart[b] || written <= end)
+            continue;
+
+        size_t lastSlot = written - B;
+        if (lastSlot == overflowSlot)
+        {
+            // The last block straddles n and was parked in overflowBlock
+            std::copy(overflowBlock.begin(), overflowBlock.begin() + (end - lastSlot), data + lastSlot);
+            spill[b].assign(overflowBlock.begin() + (end - lastSlot), overflowBlock.end());
+        }
+        else
+        {
+            spill[b].assign(data + end, data + written);
+        }
+    }
+
+    // Fill the gaps of each bucket from its spill and the threads' partial buffers
+    std::atomic<int> nextBucket{0};
+    runPinnedThreads(numThreads, [&](int)
+                     {
+        for (int b = nextBucket++; b < numBuckets; b = nextBucket++)
+        {
+            size_t begin = bucketStart[b];
+            size_t end = bucketStart[b + 1];
+            bool hasBlocks = pointers[b].write > regionStart[b];
+            size_t placedBegin = hasBlocks ? regionStart[b] : begin;
+            size_t placedEnd = hasBlocks ? std::min(pointers[b].write, end) : begin;
+
+            size_t out = begin;
+            auto emit = [&](int value)
+            {
+                if (out == placedBegin)
+                    out = placedEnd;
+                data[out++] = value;
+            };
+
+            for (int value : spill[b])
+                emit(value);
+            for (const auto &state : states)
+            {
+                for (size_t j = 0; j < state.fill[b]; j++)
+                    emit(state.buffers[b * B + j]);
+            }
+        } });
+
+    // A bucket holding everything means the splitters could not separate the keys
+    for (int b = 0; b < numBuckets; b++)
     {
-        arr[k] = right[j];
-        k++;
-        j++;
+        if (bucketStart[b + 1] - bucketStart[b] == n)
+            return {};
     }
+
+    return bucketStart;
 }
 
-// Simplified Tim Sort implementation
-void timSort(std::vector<int> &arr)
+// Work-stealing task scheduler: each worker pops from the back of its own deque and
+// steals from the front of the others when it runs dry
+class WorkStealingScheduler
 {
-    int n = arr.size();
-    const int RUN = 32; // Size of sub-arrays to be sorted
+public:
+    using Task = std::pair<size_t, size_t>; // [begin, end)
 
-    // Sort individual sub-arrays of size RUN
-    for (int i = 0; i < n; i += RUN)
+    explicit WorkStealingScheduler(int numWorkers) : queues(numWorkers) {}
+
+    void push(int worker, Task task)
     {
-        insertionSort(arr, i, std::min((i + RUN - 1), (n - 1)));
+        pending++;
+        std::lock_guard<std::mutex> guard(queues[worker].lock);
+        queues[worker].tasks.push_back(task);
     }
 
-    // Start merging from size RUN (or 32)
-    for (int size = RUN; size < n; size = 2 * size)
+    bool pop(int worker, Task &task)
     {
-        for (int left = 0; left < n; left += 2 * size)
         {
-            int mid = left + size - 1;
-            int right = std::min((left + 2 * size - 1), (n - 1));
+            std::lock_guard<std::mutex> guard(queues[worker].lock);
+            if (!queues[worker].tasks.empty())
+            {
+                task = queues[worker].tasks.back();
+                queues[worker].tasks.pop_back();
+                return true;
+            }
+        }
 
-            if (mid < right)
+        int numWorkers = static_cast<int>(queues.size());
+        for (int i = 1; i < numWorkers; i++)
+        {
+            auto &victim = queues[(worker + i) % numWorkers];
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (!victim.tasks.empty())
             {
-                merge(arr, left, mid, right);
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
             }
         }
+
+        return false;
     }
-}
 
-// ===== INTRO SORT IMPLEMENTATION =====
+    // Call after a task (and any tasks it pushed) has been handed off
+    void taskDone() { pending--; }
 
-// Calculate log base 2 of a number (used for IntroSort)
-int log2(int n)
-{
-    return (n > 1) ? 1 + log2(n / 2) : 0;
-}
+    bool finished() const { return pending.load() == 0; }
 
-// IntroSort combines Quick Sort, Heap Sort, and Insertion Sort
-void introSort(std::vector<int> &arr, int begin, int end, int depthLimit)
+private:
+    struct WorkerQueue
+    {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<WorkerQueue> queues;
+    std::atomic<size_t> pending{0};
+};
+
+// Parallel in-place samplesort (numThreads = 0 uses all hardware threads)
+void parallelSampleSort(std::vector<int> &arr, int numThreads = 0)
 {
-    // Size of the array
-    int size = end - begin;
+    size_t n = arr.size();
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
 
-    // If the array is small, use insertion sort
-    if (size < 16)
+    if (n <= SAMPLE_SORT_BASE_CASE)
     {
-        insertionSort(arr, begin, end - 1);
+        std::sort(arr.begin(), arr.end());
         return;
     }
 
-    // If the recursion depth exceeds the limit, switch to heap sort
-    if (depthLimit == 0)
+    int *data = arr.data();
+    WorkStealingScheduler scheduler(numThreads);
+
+    // Top level: all threads partition the whole array together
+    std::vector<size_t> bounds = sampleSortPartition(data, n, numThreads);
+    if (bounds.empty())
     {
-        // Create a subvector for heap sort
-        std::vector<int> subArr(arr.begin() + begin, arr.begin() + end);
-        heapSort(subArr);
+        std::sort(arr.begin(), arr.end());
+        return;
+    }
 
-        // Copy back to the original array
-        for (int i = 0; i < size; i++)
+    for (size_t b = 0, worker = 0; b + 1 < bounds.size(); b++)
+    {
+        if (bounds[b + 1] - bounds[b] > 1)
         {
-            arr[begin + i] = subArr[i];
+            scheduler.push(static_cast<int>(worker++ % numThreads), {bounds[b], bounds[b + 1]});
         }
-
-        return;
     }
 
-    // Use QuickSort with median-of-three pivot
-    int pivot = medianOfThree(arr, begin, end - 1);
-    std::swap(arr[pivot], arr[end - 1]);
+    // Buckets: sequential partitioning steps, children go to the local deque
+    runPinnedThreads(numThreads, [&](int worker)
+                     {
+        WorkStealingScheduler::Task task;
+        while (true)
+        {
+            if (!scheduler.pop(worker, task))
+            {
+                if (scheduler.finished())
+                    break;
+                std::this_thread::yield();
+                continue;
+            }
 
-    int pi = partition(arr, begin, end - 1);
+            size_t begin = task.first;
+            size_t size = task.second - task.first;
+            std::vector<size_t> childBounds;
 
-    // Recursively sort the subarrays with reduced depth limit
-    introSort(arr, begin, pi, depthLimit - 1);
-    introSort(arr, pi + 1, end, depthLimit - 1);
-}
+            if (size > SAMPLE_SORT_BASE_CASE)
+            {
+                childBounds = sampleSortPartition(data + begin, size, 1);
+            }
 
-// Wrapper function for IntroSort
-void introSort(std::vector<int> &arr)
-{
-    if (arr.empty())
-        return;
+            if (childBounds.empty())
+            {
+                std::sort(data + begin, data + begin + size);
+            }
+            else
+            {
+                for (size_t b = 0; b + 1 < childBounds.size(); b++)
+                {
+                    if (childBounds[b + 1] - childBounds[b] > 1)
+                    {
+                        scheduler.push(worker, {begin + childBounds[b], begin + childBounds[b + 1]});
+                    }
+                }
+            }
 
-    // Set the depth limit as 2*log2(n)
-    int depthLimit = 2 * log2(arr.size());
-    introSort(arr, 0, arr.size(), depthLimit);
+            scheduler.taskDone();
+        } });
 }
 
 // ===== EXTERNAL SORTING IMPLEMENTATION =====
@@ -1942,10 +3525,10 @@ void testAdvancedSorts()
         auto copy3 = cloneVector(almostSorted);
         auto copy4 = cloneVector(reverseSorted);
 
-        auto time1 = measureExecutionTimeVoid(timSort, copy1);
-        auto time2 = measureExecutionTimeVoid(timSort, copy2);
-        auto time3 = measureExecutionTimeVoid(timSort, copy3);
-        auto time4 = measureExecutionTimeVoid(timSort, copy4);
+        auto time1 = measureExecutionTimeVoid(timSort, copy1, true);
+        auto time2 = measureExecutionTimeVoid(timSort, copy2, true);
+        auto time3 = measureExecutionTimeVoid(timSort, copy3, true);
+        auto time4 = measureExecutionTimeVoid(timSort, copy4, true);
 
         std::cout << std::left
                   << std::setw(25) << "Tim Sort"
@@ -2017,6 +3600,324 @@ void testAdvancedSorts()
     }
 }
 
+// Benchmark the sorting network base case against insertion sort
+void benchmarkSortingNetworkBaseCases()
+{
+    std::cout << "\n===== SORTING NETWORK BASE CASES =====" << std::endl;
+
+#ifdef SORTING_NETWORK_LANES
+    std::cout << "SIMD sorting networks enabled (" << SORTING_NETWORK_LANES << " lanes per register)" << std::endl;
+#else
+    std::cout << "SIMD sorting networks not compiled in (build with -mavx2 or -march=native);" << std::endl;
+    std::cout << "both columns below use insertion sort." << std::endl;
+#endif
+
+    // Part 1: base case cost in isolation - sort many independent small blocks
+    const int totalElements = 1 << 20;
+    std::vector<int> blockSizes = {8, 16, 32, 64};
+
+    std::cout << "\nBase case only (" << totalElements << " elements split into blocks, times in microseconds):" << std::endl;
+    std::cout << std::left
+              << std::setw(15) << "Block Size"
+              << std::setw(20) << "Insertion Sort"
+              << std::setw(20) << "Sorting Network"
+              << std::setw(15) << "Speedup"
+              << std::endl;
+    std::cout << std::string(70, '-') << std::endl;
+
+    for (int blockSize : blockSizes)
+    {
+        std::vector<int> data = generateRandomVector(totalElements, 0, 1000000);
+        auto copy1 = cloneVector(data);
+        auto copy2 = cloneVector(data);
+
+        auto insertionTime = measureExecutionTimeVoid([&copy1, blockSize]()
+                                                      {
+            for (int left = 0; left < static_cast<int>(copy1.size()); left += blockSize)
+                sortSmallRange(copy1, left, left + blockSize - 1, false); });
+
+        auto networkTime = measureExecutionTimeVoid([&copy2, blockSize]()
+                                                    {
+            for (int left = 0; left < static_cast<int>(copy2.size()); left += blockSize)
+                sortSmallRange(copy2, left, left + blockSize - 1, true); });
+
+        // Both base cases must produce identical blocks
+        assert(copy1 == copy2);
+        for (int left = 0; left < totalElements; left += blockSize)
+        {
+            assert(std::is_sorted(copy2.begin() + left, copy2.begin() + left + blockSize));
+        }
+
+        std::cout << std::left
+                  << std::setw(15) << blockSize
+                  << std::setw(20) << insertionTime
+                  << std::setw(20) << networkTime
+                  << std::setw(15) << static_cast<double>(std::max<long long>(insertionTime, 1)) / std::max<long long>(networkTime, 1)
+                  << std::endl;
+    }
+
+    // Float kernel on the same block sizes
+    {
+        std::vector<float> floats(totalElements);
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dis(-1000.0f, 1000.0f);
+        for (auto &value : floats)
+        {
+            value = dis(gen);
+        }
+
+        std::cout << "\nFloat sorting network (times in microseconds):" << std::endl;
+        for (int blockSize : blockSizes)
+        {
+            auto copy1 = floats;
+            auto copy2 = floats;
+
+            auto stdTime = measureExecutionTimeVoid([&copy1, blockSize]()
+                                                    {
+                for (size_t left = 0; left < copy1.size(); left += blockSize)
+                    std::sort(copy1.begin() + left, copy1.begin() + left + blockSize); });
+            auto networkTime = measureExecutionTimeVoid([&copy2, blockSize]()
+                                                        {
+                for (size_t left = 0; left < copy2.size(); left += blockSize)
+                    sortingNetworkSort(copy2.data() + left, blockSize); });
+
+            assert(copy1 == copy2);
+
+            std::cout << "  Block " << std::setw(4) << blockSize
+                      << " std::sort: " << std::setw(10) << stdTime
+                      << " network: " << networkTime << std::endl;
+        }
+    }
+
+    // Part 2: end-to-end effect on the hybrid sorts at different thresholds
+    const int n = 1000000;
+    std::vector<int> randomLarge = generateRandomVector(n, 0, n);
+    std::vector<int> thresholds = {8, 16, 32, 64};
+
+    std::cout << "\nEnd-to-end on " << n << " random elements (times in microseconds):" << std::endl;
+    std::cout << std::left
+              << std::setw(30) << "Algorithm"
+              << std::setw(12) << "Threshold"
+              << std::setw(20) << "Insertion Base"
+              << std::setw(20) << "Network Base"
+              << std::setw(15) << "Speedup"
+              << std::endl;
+    std::cout << std::string(97, '-') << std::endl;
+
+    // sorter(arr, useSortingNetwork) runs one hybrid sort with the chosen base case
+    auto runBoth = [&randomLarge](const std::string &name, int threshold, const std::function<void(std::vector<int> &, bool)> &sorter)
+    {
+        auto copy1 = cloneVector(randomLarge);
+        auto copy2 = cloneVector(randomLarge);
+
+        auto insertionTime = measureExecutionTimeVoid(sorter, copy1, false);
+        auto networkTime = measureExecutionTimeVoid(sorter, copy2, true);
+
+        assert(isSorted(copy1));
+        assert(isSorted(copy2));
+
+        std::cout << std::left
+                  << std::setw(30) << name
+                  << std::setw(12) << threshold
+                  << std::setw(20) << insertionTime
+                  << std::setw(20) << networkTime
+                  << std::setw(15) << static_cast<double>(std::max<long long>(insertionTime, 1)) / std::max<long long>(networkTime, 1)
+                  << std::endl;
+    };
+
+    for (int threshold : thresholds)
+    {
+        // hybridMergeSort uses right - left <= threshold, so pass threshold - 1
+        runBoth("Hybrid Merge Sort", threshold, [threshold](std::vector<int> &arr, bool useSortingNetwork)
+                { hybridMergeSort(arr, threshold - 1, useSortingNetwork); });
+    }
+
+    for (int threshold : thresholds)
+    {
+        runBoth("Hybrid Quick Sort", threshold, [threshold](std::vector<int> &arr, bool useSortingNetwork)
+                { hybridQuickSort(arr, threshold, useSortingNetwork); });
+    }
+
+    runBoth("IntroSort", 16, [](std::vector<int> &arr, bool useSortingNetwork)
+            { introSort(arr, useSortingNetwork); });
+    runBoth("Tim Sort", 32, [](std::vector<int> &arr, bool useSortingNetwork)
+            { timSort(arr, useSortingNetwork); });
+}
+
+// Thread scaling of the parallel sorts on a large random array
+void benchmarkParallelSampleSort()
+{
+    std::cout << "\n===== PARALLEL SAMPLE SORT SCALING =====" << std::endl;
+
+    const int n = 10000000;
+    std::vector<int> data = generateRandomVector(n, 0, std::numeric_limits<int>::max());
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    auto stdCopy = cloneVector(data);
+    auto stdTime = measureExecutionTimeVoid([&stdCopy]()
+                                            { std::sort(stdCopy.begin(), stdCopy.end()); });
+
+    std::cout << "Sorting " << n << " random integers, std::sort: " << stdTime << " microseconds" << std::endl;
+    std::cout << "CPUs in NUMA order:";
+    for (int cpu : numaOrderedCpus())
+    {
+        std::cout << " " << cpu;
+    }
+    std::cout << std::endl;
+
+    std::cout << std::left
+              << std::setw(10) << "Threads"
+              << std::setw(22) << "Parallel Merge Sort"
+              << std::setw(22) << "Parallel Sample Sort"
+              << std::setw(22) << "Speedup vs std::sort"
+              << std::endl;
+    std::cout << std::string(76, '-') << std::endl;
+
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts)
+    {
+        auto copy1 = cloneVector(data);
+        auto copy2 = cloneVector(data);
+
+        auto mergeTime = measureExecutionTimeVoid([&copy1, threads]()
+                                                  { parallelMergeSort(copy1, threads); });
+        auto sampleTime = measureExecutionTimeVoid([&copy2, threads]()
+                                                   { parallelSampleSort(copy2, threads); });
+
+        assert(copy1 == stdCopy);
+        assert(copy2 == stdCopy);
+
+        std::cout << std::left
+                  << std::setw(10) << threads
+                  << std::setw(22) << mergeTime
+                  << std::setw(22) << sampleTime
+                  << std::setw(22) << static_cast<double>(stdTime) / std::max<long long>(sampleTime, 1)
+                  << std::endl;
+    }
+}
+
+// Run every fixed algorithm and the adaptive front-end over a matrix of input shapes
+void benchmarkAdaptiveSort()
+{
+    std::cout << "\n===== ADAPTIVE SORT FRONT-END =====" << std::endl;
+
+    struct InputShape
+    {
+        std::string name;
+        std::function<std::vector<int>(int)> generate;
+    };
+
+    std::vector<InputShape> shapes = {
+        {"Random", [](int n)
+         { return generateRandomVector(n, 0, 1000000000); }},
+        {"Random 0..1000", [](int n)
+         { return generateRandomVector(n, 0, 1000); }},
+        {"Nearly Sorted", [](int n)
+         { return generateNearlySortedVector(n, n / 100, 0, 10 * n); }},
+        {"16 Sorted Runs", [](int n)
+         {
+             std::vector<int> v = generateRandomVector(n, 0, 1000000000);
+             for (int run = 0; run < 16; run++)
+                 std::sort(v.begin() + static_cast<long>(n) * run / 16, v.begin() + static_cast<long>(n) * (run + 1) / 16);
+             return v; }},
+        {"Reverse Sorted", [](int n)
+         { return generateReverseSortedVector(n, 0, 10 * n); }},
+        {"10 Unique Keys", [](int n)
+         { return generateVectorWithDuplicates(n, 10, 0, 1000000000); }},
+    };
+
+    struct FixedAlgorithm
+    {
+        std::string name;
+        std::function<void(std::vector<int> &)> sort;
+    };
+
+    std::vector<FixedAlgorithm> algorithms = {
+        {"Tim Sort", [](std::vector<int> &v)
+         { timSort(v); }},
+        {"3-Way QS", [](std::vector<int> &v)
+         { threeWayQuickSort(v); }},
+        {"Radix Sort", [](std::vector<int> &v)
+         { radixSort(v); }},
+        {"pdqsort", [](std::vector<int> &v)
+         { pdqSort(v); }},
+        {"std::sort", [](std::vector<int> &v)
+         { std::sort(v.begin(), v.end()); }},
+    };
+
+    std::vector<int> sizes = {10000, 1000000};
+
+    for (int size : sizes)
+    {
+        std::cout << "\nArray size: " << size << " (times in microseconds)" << std::endl;
+        std::cout << std::left << std::setw(18) << "Input";
+        for (const auto &algorithm : algorithms)
+        {
+            std::cout << std::setw(12) << algorithm.name;
+        }
+        std::cout << std::setw(12) << "Adaptive"
+                  << std::setw(24) << "Chosen Algorithm"
+                  << std::setw(10) << "vs Best" << std::endl;
+        std::cout << std::string(18 + 12 * (algorithms.size() + 1) + 34, '-') << std::endl;
+
+        for (const auto &shape : shapes)
+        {
+            std::vector<int> data = shape.generate(size);
+            std::cout << std::left << std::setw(18) << shape.name;
+
+            long long bestFixed = std::numeric_limits<long long>::max();
+            for (const auto &algorithm : algorithms)
+            {
+                auto copy = cloneVector(data);
+                auto time = measureExecutionTimeVoid([&]()
+                                                     { algorithm.sort(copy); });
+                assert(isSorted(copy));
+                bestFixed = std::min<long long>(bestFixed, time);
+                std::cout << std::setw(12) << time;
+            }
+
+            auto copy = cloneVector(data);
+            SortStatistics stats;
+            auto adaptiveTime = measureExecutionTimeVoid([&]()
+                                                         { adaptiveSort(copy, stats); });
+            assert(isSorted(copy));
+
+            std::cout << std::setw(12) << adaptiveTime
+                      << std::setw(24) << stats.algorithm
+                      << std::fixed << std::setprecision(2)
+                      << static_cast<double>(std::max<long long>(adaptiveTime, 1)) / std::max<long long>(bestFixed, 1) << "x"
+                      << std::defaultfloat << std::endl;
+        }
+    }
+
+    // Show what the profiler measured for each shape
+    std::cout << "\nPresortedness profiles (size 1000000):" << std::endl;
+    std::cout << std::left
+              << std::setw(18) << "Input"
+              << std::setw(14) << "Descents"
+              << std::setw(14) << "Inversions"
+              << std::setw(14) << "Duplicates"
+              << std::setw(14) << "Key Range" << std::endl;
+    std::cout << std::string(74, '-') << std::endl;
+    for (const auto &shape : shapes)
+    {
+        PresortednessProfile profile = measurePresortedness(shape.generate(1000000));
+        std::cout << std::left << std::fixed << std::setprecision(4)
+                  << std::setw(18) << shape.name
+                  << std::setw(14) << profile.descentRatio
+                  << std::setw(14) << profile.inversionRatio
+                  << std::setw(14) << profile.duplicateRatio
+                  << std::setw(14) << profile.keyRange
+                  << std::defaultfloat << std::endl;
+    }
+}
+
 // Test external sorting
 void testExternalSort()
 {
@@ -2179,10 +4080,10 @@ void compareAllSortingAlgorithms()
         auto copy3 = cloneVector(almostSorted);
         auto copy4 = cloneVector(manyDuplicates);
 
-        auto time1 = measureExecutionTimeVoid(timSort, copy1);
-        auto time2 = measureExecutionTimeVoid(timSort, copy2);
-        auto time3 = measureExecutionTimeVoid(timSort, copy3);
-        auto time4 = measureExecutionTimeVoid(timSort, copy4);
+        auto time1 = measureExecutionTimeVoid(timSort, copy1, true);
+        auto time2 = measureExecutionTimeVoid(timSort, copy2, true);
+        auto time3 = measureExecutionTimeVoid(timSort, copy3, true);
+        auto time4 = measureExecutionTimeVoid(timSort, copy4, true);
 
         std::cout << std::left
                   << std::setw(25) << "Tim Sort"
@@ -2226,6 +4127,64 @@ void compareAllSortingAlgorithms()
         assert(isSorted(copy4));
     }
 
+    // Parallel Merge Sort
+    {
+        auto copy1 = cloneVector(randomSmall);
+        auto copy2 = cloneVector(randomLarge);
+        auto copy3 = cloneVector(almostSorted);
+        auto copy4 = cloneVector(manyDuplicates);
+
+        auto sorter = [](std::vector<int> &arr)
+        { parallelMergeSort(arr, std::max(1u, std::thread::hardware_concurrency())); };
+        auto time1 = measureExecutionTimeVoid(sorter, copy1);
+        auto time2 = measureExecutionTimeVoid(sorter, copy2);
+        auto time3 = measureExecutionTimeVoid(sorter, copy3);
+        auto time4 = measureExecutionTimeVoid(sorter, copy4);
+
+        std::cout << std::left
+                  << std::setw(25) << "Parallel Merge Sort"
+                  << std::setw(15) << time1
+                  << std::setw(15) << time2
+                  << std::setw(15) << time3
+                  << std::setw(15) << time4
+                  << std::endl;
+
+        // Verify sorting correctness
+        assert(isSorted(copy1));
+        assert(isSorted(copy2));
+        assert(isSorted(copy3));
+        assert(isSorted(copy4));
+    }
+
+    // Parallel Sample Sort (IPS4o-style, all hardware threads, NUMA-pinned)
+    {
+        auto copy1 = cloneVector(randomSmall);
+        auto copy2 = cloneVector(randomLarge);
+        auto copy3 = cloneVector(almostSorted);
+        auto copy4 = cloneVector(manyDuplicates);
+
+        auto sorter = [](std::vector<int> &arr)
+        { parallelSampleSort(arr); };
+        auto time1 = measureExecutionTimeVoid(sorter, copy1);
+        auto time2 = measureExecutionTimeVoid(sorter, copy2);
+        auto time3 = measureExecutionTimeVoid(sorter, copy3);
+        auto time4 = measureExecutionTimeVoid(sorter, copy4);
+
+        std::cout << std::left
+                  << std::setw(25) << "Parallel Sample Sort"
+                  << std::setw(15) << time1
+                  << std::setw(15) << time2
+                  << std::setw(15) << time3
+                  << std::setw(15) << time4
+                  << std::endl;
+
+        // Verify sorting correctness
+        assert(isSorted(copy1));
+        assert(isSorted(copy2));
+        assert(isSorted(copy3));
+        assert(isSorted(copy4));
+    }
+
     // std::sort (for comparison)
     {
         auto copy1 = cloneVector(randomSmall);
@@ -2355,13 +4314,10 @@ void studentRecordsSorting()
         std::cout << student.toString() << std::endl;
     }
 
-    // Sort by ID using stable sort (equivalent to Merge Sort)
-    std::cout << "\nSorting by ID (using stable_sort):" << std::endl;
-    std::stable_sort(students.begin(), students.end(),
-                     [](const Student &a, const Student &b)
-                     {
-                         return a.id < b.id;
-                     });
+    // Sort by ID with key-index sort: radix sort (id, index) pairs, then move each record once
+    std::cout << "\nSorting by ID (using keyIndexSort):" << std::endl;
+    keyIndexSort(students, [](const Student &s)
+                 { return s.id; });
 
     for (const auto &student : students)
     {
@@ -2521,8 +4477,9 @@ void logFileSorting()
         int end = std::min(i + chunkSize, static_cast<int>(logEntries.size()));
         std::vector<LogEntry> chunk(logEntries.begin() + i, logEntries.begin() + end);
 
-        // Sort the chunk
-        std::sort(chunk.begin(), chunk.end());
+        // Sort the chunk by timestamp without swapping whole entries
+        keyIndexSort(chunk, [](const LogEntry &e) -> const std::string &
+                     { return e.timestamp; });
         chunks.push_back(chunk);
 
         std::cout << "\nSorted chunk " << (i / chunkSize + 1) << ":" << std::endl;
@@ -2569,6 +4526,107 @@ void logFileSorting()
     }
 }
 
+// Large record with a fixed-size payload, used to benchmark key-index sorting
+template <size_t PayloadBytes>
+struct LargeRecord
+{
+    int id;
+    std::string name;
+    std::array<char, PayloadBytes> payload;
+};
+
+// Time std::sort against keyIndexSort for one record size
+template <size_t PayloadBytes>
+void runKeyIndexSortBenchmark(size_t totalBytes)
+{
+    using Record = LargeRecord<PayloadBytes>;
+    int count = static_cast<int>(totalBytes / sizeof(Record));
+
+    std::mt19937 gen(PayloadBytes);
+    std::uniform_int_distribution<> idDis(0, 1 << 30);
+
+    std::vector<Record> records(count);
+    for (auto &record : records)
+    {
+        record.id = idDis(gen);
+        record.name = "user_" + std::to_string(idDis(gen));
+        record.payload.fill(static_cast<char>(record.id & 0x7F));
+    }
+
+    auto byId = [](const Record &r)
+    { return r.id; };
+    auto byName = [](const Record &r) -> const std::string &
+    { return r.name; };
+
+    // Sort by integer key
+    auto copy1 = records;
+    auto copy2 = records;
+    auto stdIdTime = measureExecutionTimeVoid([&copy1]()
+                                              { std::sort(copy1.begin(), copy1.end(), [](const Record &a, const Record &b)
+                                                          { return a.id < b.id; }); });
+    auto keyIdTime = measureExecutionTimeVoid([&copy2, &byId]()
+                                              { keyIndexSort(copy2, byId); });
+
+    for (int i = 0; i < count; i++)
+    {
+        assert(copy1[i].id == copy2[i].id);
+        assert(copy2[i].payload[PayloadBytes - 1] == static_cast<char>(copy2[i].id & 0x7F));
+    }
+
+    // Sort by string key
+    copy1 = records;
+    copy2 = records;
+    auto stdNameTime = measureExecutionTimeVoid([&copy1]()
+                                                { std::sort(copy1.begin(), copy1.end(), [](const Record &a, const Record &b)
+                                                            { return a.name < b.name; }); });
+    auto keyNameTime = measureExecutionTimeVoid([&copy2, &byName]()
+                                                { keyIndexSort(copy2, byName); });
+
+    for (int i = 0; i < count; i++)
+    {
+        assert(copy1[i].name == copy2[i].name);
+        assert(copy2[i].payload[0] == static_cast<char>(copy2[i].id & 0x7F));
+    }
+
+    std::cout << std::left
+              << std::setw(12) << (std::to_string(PayloadBytes / 1024) + " KB")
+              << std::setw(10) << count
+              << std::setw(15) << stdIdTime
+              << std::setw(15) << keyIdTime
+              << std::setw(10) << std::fixed << std::setprecision(2)
+              << static_cast<double>(stdIdTime) / std::max<long long>(keyIdTime, 1)
+              << std::setw(15) << stdNameTime
+              << std::setw(15) << keyNameTime
+              << std::setw(10) << static_cast<double>(stdNameTime) / std::max<long long>(keyNameTime, 1)
+              << std::defaultfloat << std::endl;
+}
+
+// Compare key-index sorting with direct std::sort on 1-64 KB records
+void benchmarkKeyIndexSort()
+{
+    std::cout << "\n===== KEY-INDEX SORT FOR LARGE RECORDS =====" << std::endl;
+
+    const size_t totalBytes = 64 * 1024 * 1024;
+
+    std::cout << "\nSorting " << totalBytes / (1024 * 1024) << " MB of records (times in microseconds):" << std::endl;
+    std::cout << std::left
+              << std::setw(12) << "Payload"
+              << std::setw(10) << "Count"
+              << std::setw(15) << "std::sort id"
+              << std::setw(15) << "key-index id"
+              << std::setw(10) << "Speedup"
+              << std::setw(15) << "std::sort name"
+              << std::setw(15) << "key-index name"
+              << std::setw(10) << "Speedup"
+              << std::endl;
+    std::cout << std::string(102, '-') << std::endl;
+
+    runKeyIndexSortBenchmark<1024>(totalBytes);
+    runKeyIndexSortBenchmark<4 * 1024>(totalBytes);
+    runKeyIndexSortBenchmark<16 * 1024>(totalBytes);
+    runKeyIndexSortBenchmark<64 * 1024>(totalBytes);
+}
+
 // ===== LEETCODE-STYLE PROBLEMS =====
 
 // Merge Sorted Array (LeetCode #88)
@@ -2738,16 +4796,22 @@ int main()
     testHeapSort();
     testAdvancedSorts();
 
+    // Sorting network base cases for the hybrid sorts
+    benchmarkSortingNetworkBaseCases();
+
     // Test external sorting
     testExternalSort();
 
     // Compare all sorting algorithms
     compareAllSortingAlgorithms();
+    benchmarkParallelSampleSort();
+    benchmarkAdaptiveSort();
 
     // Real-world examples
     studentRecordsSorting();
     medianFinding();
     logFileSorting();
+    benchmarkKeyIndexSort();
 
     // LeetCode-style problems
     testLeetcodeProblems();
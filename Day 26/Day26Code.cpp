@@ -10,6 +10,8 @@
 #include <string>
 #include <list>
 #include <set>
+#include <thread>
+#include <cmath>
 
 /**
  * @brief Comprehensive Heap Sort & Applications Implementation for #DSAin45 Day 26
@@ -21,6 +23,7 @@
  * - Median in a Data Stream
  * - Merge K Sorted Lists
  * - K Closest Points to Origin
+ * - Selection engine (introselect, Floyd-Rivest, parallel and streaming top-K)
  * - Performance benchmarks
  *
  * @author #DSAin45 Course
@@ -290,6 +293,455 @@ T findKthLargestQuickSelect(std::vector<T> &nums, int k)
     return quickSelect(0, nums.size() - 1, quickSelect);
 }
 
+/****************************************************************************************
+ * SELECTION ENGINE: INTROSELECT, FLOYD-RIVEST, PARALLEL AND STREAMING TOP-K
+ ****************************************************************************************/
+
+/**
+ * @brief Three-way partition of nums[left..right] around a pivot value
+ * After the call: [left, lt) < pivot, [lt, gt] == pivot, (gt, right] > pivot
+ */
+template <typename T>
+void partitionThreeWay(std::vector<T> &nums, size_t left, size_t right, const T &pivot, size_t &lt, size_t &gt)
+{
+    size_t i = left;
+    lt = left;
+    gt = right + 1;
+
+    while (i < gt)
+    {
+        if (nums[i] < pivot)
+        {
+            std::swap(nums[lt++], nums[i++]);
+        }
+        else if (pivot < nums[i])
+        {
+            std::swap(nums[i], nums[--gt]);
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    gt--;
+}
+
+/**
+ * @brief Insertion sort of nums[left..right], used for tiny ranges
+ */
+template <typename T>
+void insertionSortRange(std::vector<T> &nums, size_t left, size_t right)
+{
+    for (size_t i = left + 1; i <= right; i++)
+    {
+        T key = nums[i];
+        size_t j = i;
+
+        while (j > left && key < nums[j - 1])
+        {
+            nums[j] = nums[j - 1];
+            j--;
+        }
+
+        nums[j] = key;
+    }
+}
+
+template <typename T>
+T introSelectRange(std::vector<T> &nums, size_t left, size_t right, size_t k, int badPivotBudget);
+
+/**
+ * @brief Median-of-medians pivot (groups of 5), guarantees a 30/70 split
+ * Group medians are gathered at the front of the range and selected recursively.
+ */
+template <typename T>
+T medianOfMedians(std::vector<T> &nums, size_t left, size_t right)
+{
+    size_t store = left;
+
+    for (size_t i = left; i <= right; i += 5)
+    {
+        size_t end = std::min(i + 4, right);
+        insertionSortRange(nums, i, end);
+        std::swap(nums[i + (end - i) / 2], nums[store++]);
+    }
+
+    // Budget 0 keeps the recursion on the deterministic path
+    size_t mid = left + (store - left - 1) / 2;
+    return introSelectRange(nums, left, store - 1, mid, 0);
+}
+
+/**
+ * @brief Introselect on nums[left..right]: quickselect with a median-of-three pivot that
+ * falls back to median-of-medians once too many partitions fail to halve the range.
+ * Iterative, so it never recurses deeper than the median-of-medians chain (O(log n)).
+ *
+ * @param k Absolute index (0-based) of the element to select
+ * @param badPivotBudget Number of poor partitions tolerated before switching pivots
+ * @return The element that would be at index k after sorting
+ */
+template <typename T>
+T introSelectRange(std::vector<T> &nums, size_t left, size_t right, size_t k, int badPivotBudget)
+{
+    while (true)
+    {
+        if (right - left < 16)
+        {
+            insertionSortRange(nums, left, right);
+            return nums[k];
+        }
+
+        T pivot;
+        if (badPivotBudget > 0)
+        {
+            // Median of first, middle and last
+            T a = nums[left], b = nums[left + (right - left) / 2], c = nums[right];
+            pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+        }
+        else
+        {
+            pivot = medianOfMedians(nums, left, right);
+        }
+
+        size_t lt, gt;
+        partitionThreeWay(nums, left, right, pivot, lt, gt);
+
+        size_t oldSize = right - left + 1;
+        if (k < lt)
+        {
+            right = lt - 1;
+        }
+        else if (k > gt)
+        {
+            left = gt + 1;
+        }
+        else
+        {
+            return pivot;
+        }
+
+        // A good pivot at least halves the range
+        if (right - left + 1 > oldSize / 2)
+        {
+            badPivotBudget--;
+        }
+    }
+}
+
+/**
+ * @brief Worst-case O(n) selection of the k-th smallest element (0-based)
+ * Reorders nums like std::nth_element.
+ */
+template <typename T>
+T introSelect(std::vector<T> &nums, size_t k)
+{
+    int budget = 2 * static_cast<int>(std::log2(std::max<size_t>(nums.size(), 2)));
+    return introSelectRange(nums, 0, nums.size() - 1, k, budget);
+}
+
+/**
+ * @brief Floyd-Rivest selection of the k-th smallest element (0-based) in nums[left..right]
+ * Recursively selects inside a small random-looking sample to find two pivots that
+ * bracket k tightly, so the main partition touches each element ~once: n + min(k, n-k)
+ * comparisons on average.
+ */
+template <typename T>
+T floydRivestSelect(std::vector<T> &nums, long left, long right, long k)
+{
+    while (right > left)
+    {
+        if (right - left > 600)
+        {
+            // Sample so that the k-th element lands in a narrow window
+            double n = static_cast<double>(right - left + 1);
+            double i = static_cast<double>(k - left + 1);
+            double z = std::log(n);
+            double s = 0.5 * std::exp(2 * z / 3);
+            double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1 : 1);
+            long newLeft = std::max(left, static_cast<long>(k - i * s / n + sd));
+            long newRight = std::min(right, static_cast<long>(k + (n - i) * s / n + sd));
+            floydRivestSelect(nums, newLeft, newRight, k);
+        }
+
+        // Partition around t = nums[k]
+        T t = nums[k];
+        long i = left;
+        long j = right;
+
+        std::swap(nums[left], nums[k]);
+        if (t < nums[right])
+        {
+            std::swap(nums[right], nums[left]);
+        }
+
+        while (i < j)
+        {
+            std::swap(nums[i], nums[j]);
+            i++;
+            j--;
+            while (nums[i] < t)
+                i++;
+            while (t < nums[j])
+                j--;
+        }
+
+        if (!(nums[left] < t) && !(t < nums[left]))
+        {
+            std::swap(nums[left], nums[j]);
+        }
+        else
+        {
+            j++;
+            std::swap(nums[j], nums[right]);
+        }
+
+        // Shrink towards k
+        if (j <= k)
+            left = j + 1;
+        if (k <= j)
+            right = j - 1;
+    }
+
+    return nums[k];
+}
+
+/**
+ * @brief Floyd-Rivest wrapper for the k-th smallest element (0-based)
+ */
+template <typename T>
+T floydRivestSelect(std::vector<T> &nums, size_t k)
+{
+    return floydRivestSelect(nums, 0L, static_cast<long>(nums.size()) - 1, static_cast<long>(k));
+}
+
+/**
+ * @brief Parallel sample-based selection of the k-th smallest element (0-based)
+ *
+ * 1. A sorted random sample gives two splitters lo <= answer <= hi (with high probability).
+ * 2. Each thread counts its elements below lo and copies the ones in [lo, hi].
+ * 3. The answer is selected sequentially from the (small) candidate set.
+ * If the splitters miss, falls back to introselect over a copy. The input is not modified.
+ *
+ * @param numThreads Number of worker threads (0 = hardware concurrency)
+ */
+template <typename T>
+T parallelSelect(const std::vector<T> &nums, size_t k, int numThreads = 0)
+{
+    size_t n = nums.size();
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if (n < (1u << 16) || numThreads == 1)
+    {
+        std::vector<T> copy = nums;
+        return introSelect(copy, k);
+    }
+
+    // Sorted sample; the target rank in the sample is k * s / n
+    size_t sampleSize = std::min<size_t>(n, 1 << 14);
+    std::vector<T> sample(sampleSize);
+    std::mt19937_64 gen(n ^ k);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    for (auto &value : sample)
+    {
+        value = nums[pick(gen)];
+    }
+    std::sort(sample.begin(), sample.end());
+
+    long target = static_cast<long>(static_cast<double>(k) * sampleSize / n);
+    long gap = static_cast<long>(2 * std::sqrt(static_cast<double>(sampleSize)));
+    bool hasLo = target - gap >= 0;
+    bool hasHi = target + gap < static_cast<long>(sampleSize);
+    T lo = hasLo ? sample[target - gap] : T();
+    T hi = hasHi ? sample[target + gap] : T();
+
+    std::vector<size_t> belowCounts(numThreads, 0);
+    std::vector<std::vector<T>> candidates(numThreads);
+    std::vector<std::thread> threads;
+    size_t chunk = (n + numThreads - 1) / numThreads;
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back([&, t]()
+                             {
+            size_t begin = t * chunk;
+            size_t end = std::min(n, begin + chunk);
+            size_t below = 0;
+            auto &local = candidates[t];
+
+            for (size_t i = begin; i < end; i++)
+            {
+                const T &value = nums[i];
+                if (hasLo && value < lo)
+                    below++;
+                else if (!hasHi || !(hi < value))
+                    local.push_back(value);
+            }
+
+            belowCounts[t] = below; });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    size_t below = 0;
+    size_t total = 0;
+    for (int t = 0; t < numThreads; t++)
+    {
+        below += belowCounts[t];
+        total += candidates[t].size();
+    }
+
+    if (k < below || k >= below + total)
+    {
+        // Splitters missed the answer (unlikely); select over the whole input
+        std::vector<T> copy = nums;
+        return introSelect(copy, k);
+    }
+
+    std::vector<T> merged;
+    merged.reserve(total);
+    for (auto &local : candidates)
+    {
+        merged.insert(merged.end(), local.begin(), local.end());
+    }
+
+    return introSelect(merged, k - below);
+}
+
+/**
+ * @brief Parallel top-K: the k largest elements of nums (in no particular order)
+ * Finds the k-th largest value with parallelSelect, then gathers everything above it
+ * in parallel and pads with copies of the threshold value.
+ */
+template <typename T>
+std::vector<T> parallelTopK(const std::vector<T> &nums, size_t k, int numThreads = 0)
+{
+    size_t n = nums.size();
+    if (k == 0)
+        return {};
+    if (k >= n)
+        return nums;
+
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    T threshold = parallelSelect(nums, n - k, numThreads);
+
+    std::vector<std::vector<T>> above(numThreads);
+    std::vector<std::thread> threads;
+    size_t chunk = (n + numThreads - 1) / numThreads;
+
+    for (int t = 0; t < numThreads; t++)
+    {
+        threads.emplace_back([&, t]()
+                             {
+            size_t begin = t * chunk;
+            size_t end = std::min(n, begin + chunk);
+            for (size_t i = begin; i < end; i++)
+            {
+                if (threshold < nums[i])
+                    above[t].push_back(nums[i]);
+            } });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<T> result;
+    result.reserve(k);
+    for (auto &local : above)
+    {
+        result.insert(result.end(), local.begin(), local.end());
+    }
+    result.resize(k, threshold);
+
+    return result;
+}
+
+/**
+ * @brief Streaming top-K with a bounded min heap
+ * Keeps the k largest values seen so far in O(k) memory. Values that cannot enter
+ * the heap are rejected with a single comparison against the heap minimum.
+ */
+template <typename T>
+class StreamingTopK
+{
+private:
+    size_t capacity;
+    std::vector<T> heap; // min heap via std::greater
+
+public:
+    explicit StreamingTopK(size_t k) : capacity(k)
+    {
+        heap.reserve(k);
+    }
+
+    /**
+     * @brief Offer a value from the stream
+     */
+    void push(const T &value)
+    {
+        if (capacity == 0)
+            return;
+
+        if (heap.size() < capacity)
+        {
+            heap.push_back(value);
+            std::push_heap(heap.begin(), heap.end(), std::greater<T>());
+        }
+        else if (heap.front() < value)
+        {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<T>());
+            heap.back() = value;
+            std::push_heap(heap.begin(), heap.end(), std::greater<T>());
+        }
+    }
+
+    /**
+     * @brief Combine with another stream's top-K (e.g. one per thread)
+     */
+    void merge(const StreamingTopK &other)
+    {
+        for (const T &value : other.heap)
+        {
+            push(value);
+        }
+    }
+
+    /**
+     * @brief Smallest of the current top-K (the k-th largest so far)
+     */
+    const T &threshold() const
+    {
+        return heap.front();
+    }
+
+    size_t size() const
+    {
+        return heap.size();
+    }
+
+    /**
+     * @brief Current top-K in descending order
+     */
+    std::vector<T> sortedResults() const
+    {
+        std::vector<T> result = heap;
+        std::sort(result.begin(), result.end(), std::greater<T>());
+        return result;
+    }
+};
+
 /****************************************************************************************
  * TOP K FREQUENT ELEMENTS IMPLEMENTATION
  ****************************************************************************************/
@@ -1160,6 +1612,65 @@ void demoKthElement()
     std::cout << std::endl;
 }
 
+/**
+ * @brief Demonstrate the selection engine (introselect, Floyd-Rivest, top-K)
+ */
+void demoSelectionEngine()
+{
+    std::cout << "===== Selection Engine Demonstration =====" << std::endl;
+
+    std::vector<int> arr = generateRandomVector(15, 1, 100);
+    printVector(arr, "Original array");
+
+    std::vector<int> sortedArr = arr;
+    std::sort(sortedArr.begin(), sortedArr.end());
+
+    // Median by introselect and Floyd-Rivest (both reorder their input)
+    size_t mid = arr.size() / 2;
+    auto copy = arr;
+    int introMedian = introSelect(copy, mid);
+    copy = arr;
+    int frMedian = floydRivestSelect(copy, mid);
+    std::cout << "Median (introselect): " << introMedian << std::endl;
+    std::cout << "Median (Floyd-Rivest): " << frMedian << std::endl;
+
+    // Top-3 from a stream
+    StreamingTopK<int> topK(3);
+    for (int value : arr)
+    {
+        topK.push(value);
+    }
+    printVector(topK.sortedResults(), "Top 3 (streaming)");
+
+    // The same top-3 from two half-streams merged, as one per thread would be
+    StreamingTopK<int> firstHalf(3);
+    StreamingTopK<int> secondHalf(3);
+    for (size_t i = 0; i < arr.size(); i++)
+    {
+        (i < arr.size() / 2 ? firstHalf : secondHalf).push(arr[i]);
+    }
+    firstHalf.merge(secondHalf);
+    printVector(firstHalf.sortedResults(), "Top 3 (merged halves)");
+
+    // Top-5 in parallel, checked against nth_element
+    size_t k = 5;
+    std::vector<int> parallelTop = parallelTopK(arr, k, 2);
+    std::sort(parallelTop.begin(), parallelTop.end(), std::greater<int>());
+    copy = arr;
+    std::nth_element(copy.begin(), copy.begin() + k, copy.end(), std::greater<int>());
+    std::vector<int> expectedTop(copy.begin(), copy.begin() + k);
+    std::sort(expectedTop.begin(), expectedTop.end(), std::greater<int>());
+    printVector(parallelTop, "Top 5 (parallel)");
+
+    bool correct = introMedian == sortedArr[mid] && frMedian == sortedArr[mid] &&
+                   topK.sortedResults()[0] == sortedArr.back() &&
+                   firstHalf.sortedResults() == topK.sortedResults() &&
+                   parallelTop == expectedTop;
+    std::cout << "Selection engine correctness: " << (correct ? "PASS" : "FAIL") << std::endl;
+
+    std::cout << std::endl;
+}
+
 /**
  * @brief Demonstrate finding top-k frequent elements
  */
@@ -1405,6 +1916,124 @@ void demoKClosestPoints()
     std::cout << std::endl;
 }
 
+/**
+ * @brief Benchmark the selection engine against the heap and quickselect approaches
+ * for k = 1, sqrt(n) and n/2 (k-th largest)
+ *
+ * @param sizes Vector of array sizes to test
+ * @param iterations Number of iterations for each size
+ */
+void benchmarkSelectionEngine(const std::vector<int> &sizes, int iterations = 3)
+{
+    std::cout << "===== Selection Engine Benchmarks (ms) =====" << std::endl;
+    std::cout << "Threads for parallel select: " << std::max(1u, std::thread::hardware_concurrency()) << std::endl;
+    std::cout << std::setw(10) << "Size"
+              << std::setw(10) << "k"
+              << std::setw(12) << "Heap"
+              << std::setw(13) << "QuickSelect"
+              << std::setw(13) << "nth_element"
+              << std::setw(13) << "IntroSelect"
+              << std::setw(13) << "FloydRivest"
+              << std::setw(12) << "Parallel"
+              << std::setw(12) << "Streaming"
+              << std::endl;
+
+    auto elapsedMs = [](auto &&func)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        func();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    for (int size : sizes)
+    {
+        std::vector<int> ks = {1, static_cast<int>(std::sqrt(size)), size / 2};
+
+        for (int k : ks)
+        {
+            double times[7] = {0, 0, 0, 0, 0, 0, 0};
+
+            for (int it = 0; it < iterations; it++)
+            {
+                // Wide value range: the Lomuto quickselect degrades badly on many duplicates
+                auto data = generateRandomVector(size, 1, 1000000000);
+                size_t rank = size - k; // k-th largest == (n-k)-th smallest
+                int results[7];
+
+                times[0] += elapsedMs([&]()
+                                      { results[0] = findKthLargest(data, k); });
+
+                auto copy = data;
+                times[1] += elapsedMs([&]()
+                                      { results[1] = findKthLargestQuickSelect(copy, k); });
+
+                copy = data;
+                times[2] += elapsedMs([&]()
+                                      {
+                    std::nth_element(copy.begin(), copy.begin() + rank, copy.end());
+                    results[2] = copy[rank]; });
+
+                copy = data;
+                times[3] += elapsedMs([&]()
+                                      { results[3] = introSelect(copy, rank); });
+
+                copy = data;
+                times[4] += elapsedMs([&]()
+                                      { results[4] = floydRivestSelect(copy, rank); });
+
+                times[5] += elapsedMs([&]()
+                                      { results[5] = parallelSelect(data, rank); });
+
+                times[6] += elapsedMs([&]()
+                                      {
+                    StreamingTopK<int> topK(k);
+                    for (int value : data)
+                        topK.push(value);
+                    results[6] = topK.threshold(); });
+
+                for (int r = 1; r < 7; r++)
+                {
+                    if (results[r] != results[0])
+                    {
+                        std::cout << "Mismatch in column " << r << " for size " << size << ", k " << k << std::endl;
+                    }
+                }
+            }
+
+            std::cout << std::setw(10) << size
+                      << std::setw(10) << k;
+            for (int c = 0; c < 7; c++)
+            {
+                std::cout << std::setw(c == 0 || c >= 5 ? 12 : 13) << std::fixed << std::setprecision(2) << (times[c] / iterations);
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    // Sorted input is the worst case for a last-element pivot; introselect stays linear
+    {
+        int size = 20000;
+        std::vector<int> sorted = generateRandomSortedVector(size, 1, 1000000000);
+        int k = size / 2;
+
+        auto copy1 = sorted;
+        auto copy2 = sorted;
+        int r1 = 0;
+        int r2 = 0;
+        double quickSelectTime = elapsedMs([&]()
+                                           { r1 = findKthLargestQuickSelect(copy1, k); });
+        double introSelectTime = elapsedMs([&]()
+                                           { r2 = introSelect(copy2, size - k); });
+
+        std::cout << "Sorted input (n=" << size << ", k=n/2): QuickSelect "
+                  << std::fixed << std::setprecision(2) << quickSelectTime << " ms, IntroSelect "
+                  << introSelectTime << " ms" << (r1 == r2 ? "" : " (MISMATCH)") << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
 /**
  * @brief Run all benchmarks
  */
@@ -1415,6 +2044,7 @@ void runBenchmarks()
     benchmarkHeapSort(sizes);
     benchmarkKthElement(sizes);
     benchmarkTopKFrequent(sizes);
+    benchmarkSelectionEngine({1000000, 10000000});
 }
 
 /**
@@ -1429,6 +2059,7 @@ int main()
     // Run demonstrations
     demoHeapSort();
     demoKthElement();
+    demoSelectionEngine();
     demoTopKFrequent();
     demoMedianFinder();
     demoMergeKLists();
@@ -16,6 +16,12 @@
 #include <sstream>
 #include <functional>
 #include <memory>
+#include <cstdint>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 /**
  * @brief Comprehensive Graph Implementations for #DSAin45 Day 29
@@ -1946,6 +1952,556 @@ void benchmarkEdgeOperations(
  * REAL-WORLD APPLICATIONS
  ****************************************************************************************/
 
+/**
+ * @brief Read-only CSR snapshot of a graph for mutual-friend and suggestion queries
+ *
+ * Vertices are relabeled by descending degree so hubs get the smallest dense IDs.
+ * Each adjacency list is stored as a sorted, duplicate-free array inside one flat
+ * buffer (compressed sparse row). On top of that:
+ * - common neighbors are counted with an SSE2 4x4 block intersection, or by
+ *   galloping when one list is much shorter than the other;
+ * - hubs (degree >= vertices / hubDivisor) also keep a bitset neighborhood, so
+ *   intersecting with a hub costs one bit probe per element of the other list;
+ * - suggestions count friends-of-friends in a dense score array and select the
+ *   top k with std::nth_element instead of sorting every candidate.
+ *
+ * The snapshot does not follow later changes to the source graph. Suggestion
+ * queries share scratch arrays, so a snapshot must not be queried from several
+ * threads at once.
+ */
+class SocialGraphSnapshot
+{
+private:
+    int vertexCount;
+    std::vector<int64_t> offsets;          // Neighbors of v are neighbors[offsets[v] .. offsets[v + 1])
+    std::vector<int> neighbors;            // Sorted adjacency lists in dense IDs
+    std::vector<int> originalIds;          // Dense ID -> vertex ID in the source graph
+    std::unordered_map<int, int> denseIds; // Vertex ID in the source graph -> dense ID
+
+    std::vector<int> hubSlot;                   // Index into hubBits, or -1 if v is not a hub
+    std::vector<std::vector<uint64_t>> hubBits; // One bit per vertex for every hub
+
+    // Suggestion scratch, cleared after every query. Excluded vertices hold a large
+    // negative score so one array access both filters and counts a candidate.
+    std::vector<int> scores;
+    std::vector<int> touched;
+    static const int EXCLUDED = -(1 << 30);
+
+    /**
+     * @brief Build the degree-ordered CSR from directed arcs between indices 0..n-1
+     *
+     * @param n Number of vertices
+     * @param arcs Arcs (from, to); self-loops and duplicates are dropped
+     * @param hubDivisor Vertices with degree >= n / hubDivisor get a bitset
+     */
+    void build(int n, std::vector<std::pair<int, int>> &arcs, int hubDivisor)
+    {
+        vertexCount = n;
+
+        // Bucket the arcs by source, then sort and deduplicate every list
+        std::vector<int64_t> start(n + 1, 0);
+        for (const auto &arc : arcs)
+        {
+            if (arc.first != arc.second)
+            {
+                ++start[arc.first + 1];
+            }
+        }
+        for (int v = 0; v < n; ++v)
+        {
+            start[v + 1] += start[v];
+        }
+
+        std::vector<int> targets(start[n]);
+        std::vector<int64_t> cursor(start.begin(), start.end() - 1);
+        for (const auto &arc : arcs)
+        {
+            if (arc.first != arc.second)
+            {
+                targets[cursor[arc.first]++] = arc.second;
+            }
+        }
+        std::vector<std::pair<int, int>>().swap(arcs);
+
+        std::vector<int> degree(n);
+        for (int v = 0; v < n; ++v)
+        {
+            auto first = targets.begin() + start[v];
+            auto last = targets.begin() + start[v + 1];
+            std::sort(first, last);
+            degree[v] = static_cast<int>(std::unique(first, last) - first);
+        }
+
+        // Dense ID = rank by descending degree (ties keep the original order)
+        std::vector<int> order(n);
+        for (int v = 0; v < n; ++v)
+        {
+            order[v] = v;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&degree](int a, int b)
+                         { return degree[a] > degree[b]; });
+
+        std::vector<int> rank(n);
+        for (int r = 0; r < n; ++r)
+        {
+            rank[order[r]] = r;
+        }
+
+        offsets.assign(n + 1, 0);
+        for (int r = 0; r < n; ++r)
+        {
+            offsets[r + 1] = offsets[r] + degree[order[r]];
+        }
+
+        neighbors.resize(offsets[n]);
+        for (int r = 0; r < n; ++r)
+        {
+            int v = order[r];
+            int *out = neighbors.data() + offsets[r];
+            for (int i = 0; i < degree[v]; ++i)
+            {
+                out[i] = rank[targets[start[v] + i]];
+            }
+            std::sort(out, out + degree[v]);
+        }
+
+        std::vector<int> newOriginalIds(n);
+        for (int r = 0; r < n; ++r)
+        {
+            newOriginalIds[r] = originalIds[order[r]];
+        }
+        originalIds.swap(newOriginalIds);
+        denseIds.clear();
+        denseIds.reserve(n);
+        for (int r = 0; r < n; ++r)
+        {
+            denseIds[originalIds[r]] = r;
+        }
+
+        // Hubs come first in dense order, so stop at the first non-hub
+        hubSlot.assign(n, -1);
+        hubBits.clear();
+        int64_t hubDegree = std::max<int64_t>(1, n / std::max(1, hubDivisor));
+        for (int r = 0; r < n && getDegree(r) >= hubDegree; ++r)
+        {
+            hubSlot[r] = static_cast<int>(hubBits.size());
+            hubBits.emplace_back((n + 63) / 64, 0);
+            std::vector<uint64_t> &bits = hubBits.back();
+            for (int64_t i = offsets[r]; i < offsets[r + 1]; ++i)
+            {
+                bits[neighbors[i] >> 6] |= uint64_t(1) << (neighbors[i] & 63);
+            }
+        }
+
+        scores.assign(n, 0);
+        touched.clear();
+    }
+
+    /**
+     * @brief Count elements of a sorted list that are set in a hub bitset
+     */
+    static int64_t countInBitset(const int *list, int64_t size, const std::vector<uint64_t> &bits)
+    {
+        int64_t count = 0;
+        for (int64_t i = 0; i < size; ++i)
+        {
+            count += (bits[list[i] >> 6] >> (list[i] & 63)) & 1;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Count common elements of two sorted lists by galloping through the longer one
+     */
+    static int64_t countGalloping(const int *small, int64_t smallSize, const int *large, int64_t largeSize)
+    {
+        int64_t count = 0;
+        int64_t low = 0;
+        for (int64_t i = 0; i < smallSize && low < largeSize; ++i)
+        {
+            int target = small[i];
+
+            // Exponential search for the first element >= target
+            int64_t step = 1;
+            int64_t high = low;
+            while (high < largeSize && large[high] < target)
+            {
+                low = high + 1;
+                high += step;
+                step *= 2;
+            }
+            low = std::lower_bound(large + low, large + std::min(high, largeSize), target) - large;
+
+            if (low < largeSize && large[low] == target)
+            {
+                ++count;
+                ++low;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Count common elements of two sorted, duplicate-free lists
+     */
+    static int64_t countMerge(const int *a, int64_t sizeA, const int *b, int64_t sizeB)
+    {
+        int64_t count = 0;
+        int64_t i = 0;
+        int64_t j = 0;
+
+#if defined(__SSE2__)
+        // Compare 4 elements of a against all 4 rotations of 4 elements of b,
+        // then advance the block(s) with the smaller maximum
+        while (i + 4 <= sizeA && j + 4 <= sizeB)
+        {
+            __m128i blockA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+            __m128i blockB = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+
+            __m128i equal = _mm_cmpeq_epi32(blockA, blockB);
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi32(blockA, _mm_shuffle_epi32(blockB, _MM_SHUFFLE(0, 3, 2, 1))));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi32(blockA, _mm_shuffle_epi32(blockB, _MM_SHUFFLE(1, 0, 3, 2))));
+            equal = _mm_or_si128(equal, _mm_cmpeq_epi32(blockA, _mm_shuffle_epi32(blockB, _MM_SHUFFLE(2, 1, 0, 3))));
+            count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+
+            int maxA = a[i + 3];
+            int maxB = b[j + 3];
+            if (maxA <= maxB)
+            {
+                i += 4;
+            }
+            if (maxB <= maxA)
+            {
+                j += 4;
+            }
+        }
+#endif
+
+        // Branch-light scalar merge for the remainder
+        while (i < sizeA && j < sizeB)
+        {
+            int x = a[i];
+            int y = b[j];
+            count += x == y;
+            i += x <= y;
+            j += y <= x;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Number of common neighbors of two vertices given by dense IDs
+     */
+    int64_t countCommon(int u, int v) const
+    {
+        // Probe the shorter list against the longer one
+        if (getDegree(u) > getDegree(v))
+        {
+            std::swap(u, v);
+        }
+        const int *listU = neighbors.data() + offsets[u];
+        const int *listV = neighbors.data() + offsets[v];
+        int64_t sizeU = getDegree(u);
+        int64_t sizeV = getDegree(v);
+
+        if (sizeU == 0)
+        {
+            return 0;
+        }
+        if (hubSlot[v] >= 0)
+        {
+            return countInBitset(listU, sizeU, hubBits[hubSlot[v]]);
+        }
+        if (sizeV / sizeU >= 32)
+        {
+            return countGalloping(listU, sizeU, listV, sizeV);
+        }
+        return countMerge(listU, sizeU, listV, sizeV);
+    }
+
+    /**
+     * @brief Top-k friends-of-friends of a dense vertex, scored by mutual connections
+     */
+    std::vector<std::pair<int, int>> suggestDense(int u, int k)
+    {
+        // Exclude the user and the existing connections
+        scores[u] = EXCLUDED;
+        for (int64_t i = offsets[u]; i < offsets[u + 1]; ++i)
+        {
+            scores[neighbors[i]] = EXCLUDED;
+        }
+
+        for (int64_t i = offsets[u]; i < offsets[u + 1]; ++i)
+        {
+            int friendId = neighbors[i];
+            for (int64_t j = offsets[friendId]; j < offsets[friendId + 1]; ++j)
+            {
+                int candidate = neighbors[j];
+                if (scores[candidate]++ == 0)
+                {
+                    touched.push_back(candidate);
+                }
+            }
+        }
+
+        // Higher score first, then higher degree (smaller dense ID)
+        auto better = [this](int a, int b)
+        {
+            return scores[a] != scores[b] ? scores[a] > scores[b] : a < b;
+        };
+        size_t limit = std::min(touched.size(), static_cast<size_t>(std::max(0, k)));
+        std::nth_element(touched.begin(), touched.begin() + limit, touched.end(), better);
+        std::sort(touched.begin(), touched.begin() + limit, better);
+
+        std::vector<std::pair<int, int>> result;
+        result.reserve(limit);
+        for (size_t i = 0; i < limit; ++i)
+        {
+            result.emplace_back(originalIds[touched[i]], scores[touched[i]]);
+        }
+
+        for (int candidate : touched)
+        {
+            scores[candidate] = 0;
+        }
+        scores[u] = 0;
+        for (int64_t i = offsets[u]; i < offsets[u + 1]; ++i)
+        {
+            scores[neighbors[i]] = 0;
+        }
+        touched.clear();
+        return result;
+    }
+
+public:
+    /**
+     * @brief Snapshot an IGraph (uses the out-neighbors of every vertex)
+     *
+     * @param graph Source graph
+     * @param hubDivisor Vertices with degree >= vertices / hubDivisor get a bitset neighborhood
+     */
+    explicit SocialGraphSnapshot(const IGraph &graph, int hubDivisor = 64)
+    {
+        originalIds = graph.getVertices();
+        int n = static_cast<int>(originalIds.size());
+
+        std::unordered_map<int, int> index;
+        index.reserve(n);
+        for (int i = 0; i < n; ++i)
+        {
+            index[originalIds[i]] = i;
+        }
+
+        std::vector<std::pair<int, int>> arcs;
+        arcs.reserve(graph.getEdgeCount() * (graph.isDirected() ? 1 : 2));
+        for (int i = 0; i < n; ++i)
+        {
+            for (int to : graph.getNeighbors(originalIds[i]))
+            {
+                arcs.emplace_back(i, index[to]);
+            }
+        }
+
+        build(n, arcs, hubDivisor);
+    }
+
+    /**
+     * @brief Snapshot an edge list over vertices 0..vertexCount-1
+     *
+     * @param vertexCount Number of vertices
+     * @param edges Edge list; an undirected edge is stored in both directions
+     * @param directed Whether edges are directed
+     * @param hubDivisor Vertices with degree >= vertices / hubDivisor get a bitset neighborhood
+     */
+    SocialGraphSnapshot(int vertexCount, const std::vector<std::pair<int, int>> &edges,
+                        bool directed = false, int hubDivisor = 64)
+    {
+        originalIds.resize(vertexCount);
+        for (int i = 0; i < vertexCount; ++i)
+        {
+            originalIds[i] = i;
+        }
+
+        std::vector<std::pair<int, int>> arcs;
+        arcs.reserve(edges.size() * (directed ? 1 : 2));
+        for (const auto &edge : edges)
+        {
+            arcs.push_back(edge);
+            if (!directed)
+            {
+                arcs.emplace_back(edge.second, edge.first);
+            }
+        }
+
+        build(vertexCount, arcs, hubDivisor);
+    }
+
+    /**
+     * @brief Number of vertices in the snapshot
+     */
+    int getVertexCount() const
+    {
+        return vertexCount;
+    }
+
+    /**
+     * @brief Number of stored arcs (an undirected edge counts twice)
+     */
+    int64_t getArcCount() const
+    {
+        return offsets[vertexCount];
+    }
+
+    /**
+     * @brief Number of vertices with a bitset neighborhood
+     */
+    int getHubCount() const
+    {
+        return static_cast<int>(hubBits.size());
+    }
+
+    /**
+     * @brief Out-degree of a vertex by dense ID (0 = highest degree)
+     */
+    int64_t getDegree(int denseId) const
+    {
+        return offsets[denseId + 1] - offsets[denseId];
+    }
+
+    /**
+     * @brief Dense ID of a vertex of the source graph, or -1 if unknown
+     */
+    int toDenseId(int vertex) const
+    {
+        auto it = denseIds.find(vertex);
+        return it == denseIds.end() ? -1 : it->second;
+    }
+
+    /**
+     * @brief Vertex of the source graph for a dense ID
+     */
+    int toOriginalId(int denseId) const
+    {
+        return originalIds[denseId];
+    }
+
+    /**
+     * @brief Count mutual connections of two vertices
+     *
+     * @return Number of common neighbors, or -1 if a vertex is unknown
+     */
+    int64_t mutualCount(int vertex1, int vertex2) const
+    {
+        int u = toDenseId(vertex1);
+        int v = toDenseId(vertex2);
+        if (u < 0 || v < 0)
+        {
+            return -1;
+        }
+        return countCommon(u, v);
+    }
+
+    /**
+     * @brief List the mutual connections of two vertices
+     *
+     * @return Common neighbors (vertex IDs of the source graph), highest degree first
+     */
+    std::vector<int> mutualConnections(int vertex1, int vertex2) const
+    {
+        int u = toDenseId(vertex1);
+        int v = toDenseId(vertex2);
+        if (u < 0 || v < 0)
+        {
+            return {};
+        }
+
+        std::vector<int> result;
+        std::set_intersection(
+            neighbors.begin() + offsets[u], neighbors.begin() + offsets[u + 1],
+            neighbors.begin() + offsets[v], neighbors.begin() + offsets[v + 1],
+            std::back_inserter(result));
+
+        for (int &id : result)
+        {
+            id = originalIds[id];
+        }
+        return result;
+    }
+
+    /**
+     * @brief Suggest connections for a vertex, scored by number of mutual connections
+     *
+     * @param vertex Vertex of the source graph
+     * @param k Maximum number of suggestions
+     * @return (vertex, mutual connections) pairs, best first; ties go to higher degree
+     */
+    std::vector<std::pair<int, int>> suggest(int vertex, int k = 5)
+    {
+        int u = toDenseId(vertex);
+        if (u < 0)
+        {
+            return {};
+        }
+        return suggestDense(u, k);
+    }
+
+    /**
+     * @brief Suggest connections for many vertices, reusing the scratch arrays
+     *
+     * @param vertices Vertices of the source graph
+     * @param k Maximum number of suggestions per vertex
+     * @return One suggestion list per input vertex
+     */
+    std::vector<std::vector<std::pair<int, int>>> suggestBatch(const std::vector<int> &vertices, int k = 5)
+    {
+        std::vector<std::vector<std::pair<int, int>>> results;
+        results.reserve(vertices.size());
+        for (int vertex : vertices)
+        {
+            results.push_back(suggest(vertex, k));
+        }
+        return results;
+    }
+
+    /**
+     * @brief Rank externally generated candidates by mutual connections with a vertex
+     *
+     * @param vertex Vertex of the source graph
+     * @param candidates Candidate vertices (unknown ones are skipped)
+     * @param k Maximum number of results
+     * @return (candidate, mutual connections) pairs, best first
+     */
+    std::vector<std::pair<int, int>> rankCandidates(int vertex, const std::vector<int> &candidates, int k = 5) const
+    {
+        int u = toDenseId(vertex);
+        if (u < 0)
+        {
+            return {};
+        }
+
+        std::vector<std::pair<int, int>> scored;
+        scored.reserve(candidates.size());
+        for (int candidate : candidates)
+        {
+            int v = toDenseId(candidate);
+            if (v >= 0 && v != u)
+            {
+                scored.emplace_back(candidate, static_cast<int>(countCommon(u, v)));
+            }
+        }
+
+        auto better = [](const std::pair<int, int> &a, const std::pair<int, int> &b)
+        {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        };
+        size_t limit = std::min(scored.size(), static_cast<size_t>(std::max(0, k)));
+        std::partial_sort(scored.begin(), scored.begin() + limit, scored.end(), better);
+        scored.resize(limit);
+        return scored;
+    }
+};
+
 /**
  * @brief Simple social network class using graphs
  */
@@ -1956,6 +2512,7 @@ private:
     std::unordered_map<std::string, int> userIdMap;   // Maps usernames to internal IDs
     std::unordered_map<int, std::string> userNameMap; // Maps internal IDs to usernames
     int nextUserId;
+    std::unique_ptr<SocialGraphSnapshot> snapshot; // Query accelerator, dropped on every change
 
 public:
     /**
@@ -1993,6 +2550,7 @@ public:
         int userId = nextUserId++;
         userIdMap[username] = userId;
         userNameMap[userId] = username;
+        snapshot.reset();
 
         return graph->addVertex(userId);
     }
@@ -2013,6 +2571,7 @@ public:
 
         int userId = it->second;
         bool result = graph->removeVertex(userId);
+        snapshot.reset();
 
         if (result)
         {
@@ -2040,6 +2599,7 @@ public:
             return false; // One or both users don't exist
         }
 
+        snapshot.reset();
         return graph->addEdge(fromIt->second, toIt->second);
     }
 
@@ -2060,6 +2620,7 @@ public:
             return false; // One or both users don't exist
         }
 
+        snapshot.reset();
         return graph->removeEdge(fromIt->second, toIt->second);
     }
 
@@ -2111,6 +2672,25 @@ public:
         return neighbors;
     }
 
+    /**
+     * @brief Freeze the current network into a CSR snapshot that
+     * getMutualConnections and suggestConnections use until the next change
+     */
+    void buildSnapshot()
+    {
+        snapshot = std::make_unique<SocialGraphSnapshot>(*graph);
+    }
+
+    /**
+     * @brief Check whether queries currently use a snapshot
+     *
+     * @return true if a snapshot is active
+     */
+    bool hasSnapshot() const
+    {
+        return snapshot != nullptr;
+    }
+
     /**
      * @brief Get mutual connections between two users
      *
@@ -2131,6 +2711,21 @@ public:
         int id1 = it1->second;
         int id2 = it2->second;
 
+        if (snapshot)
+        {
+            // Same ascending-ID order as the path below (the snapshot ranks by degree)
+            std::vector<int> mutualIds = snapshot->mutualConnections(id1, id2);
+            std::sort(mutualIds.begin(), mutualIds.end());
+
+            std::vector<std::string> mutualNames;
+            mutualNames.reserve(mutualIds.size());
+            for (int id : mutualIds)
+            {
+                mutualNames.push_back(userNameMap[id]);
+            }
+            return mutualNames;
+        }
+
         std::vector<int> neighbors1 = graph->getNeighbors(id1);
         std::vector<int> neighbors2 = graph->getNeighbors(id2);
 
@@ -2171,6 +2766,16 @@ public:
 
         int userId = it->second;
 
+        if (snapshot)
+        {
+            std::vector<std::string> suggestions;
+            for (const auto &entry : snapshot->suggest(userId, limit))
+            {
+                suggestions.push_back(userNameMap[entry.first]);
+            }
+            return suggestions;
+        }
+
         // Get direct connections
         std::vector<int> directConnections = graph->getNeighbors(userId);
         std::unordered_set<int> directConnectionSet(directConnections.begin(), directConnections.end());
@@ -2442,6 +3047,157 @@ public:
     }
 };
 
+/**
+ * @brief Generate a power-law (Chung-Lu style) undirected edge list
+ *
+ * Vertex i is picked as an endpoint with probability proportional to
+ * (i + 1)^(-1 / (exponent - 1)), which gives a degree distribution with the
+ * requested exponent. Duplicate edges and self-loops are left in; the
+ * snapshot drops them.
+ *
+ * @param vertexCount Number of vertices
+ * @param edgeCount Number of edges to draw
+ * @param exponent Power-law exponent (> 2)
+ * @param seed Random seed
+ * @return std::vector<std::pair<int, int>> Edge list
+ */
+std::vector<std::pair<int, int>> generatePowerLawEdges(int vertexCount, int64_t edgeCount, double exponent, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    // Inverse CDF of the continuous weight x^-a on [1, n + 1]
+    double a = 1.0 / (exponent - 1.0);
+    double top = std::pow(vertexCount + 1.0, 1.0 - a) - 1.0;
+    auto drawVertex = [&]()
+    {
+        double x = std::pow(1.0 + unit(gen) * top, 1.0 / (1.0 - a));
+        return std::min(vertexCount - 1, static_cast<int>(x) - 1);
+    };
+
+    std::vector<std::pair<int, int>> edges;
+    edges.reserve(edgeCount);
+    for (int64_t i = 0; i < edgeCount; ++i)
+    {
+        edges.emplace_back(drawVertex(), drawVertex());
+    }
+    return edges;
+}
+
+/**
+ * @brief Benchmark mutual-friend queries and connection suggestions
+ *
+ * First compares SocialNetwork::suggestConnections with and without a snapshot
+ * on a small network. Then measures the snapshot alone on a large power-law graph.
+ *
+ * @param smallUsers Users in the SocialNetwork comparison
+ * @param smallEdges Friendships in the SocialNetwork comparison
+ * @param largeUsers Users in the large snapshot
+ * @param largeEdges Friendships in the large snapshot
+ * @param queryCount Number of suggestion queries per measurement
+ */
+void benchmarkSocialRecommendations(int smallUsers, int64_t smallEdges, int largeUsers, int64_t largeEdges, int queryCount)
+{
+    std::cout << "===== Social Recommendation Benchmarks =====" << std::endl;
+    std::mt19937 gen(29);
+
+    // Same API before and after buildSnapshot()
+    {
+        SocialNetwork network(false, false);
+        for (int i = 0; i < smallUsers; ++i)
+        {
+            network.addUser("user" + std::to_string(i));
+        }
+        for (const auto &edge : generatePowerLawEdges(smallUsers, smallEdges, 2.3, 1))
+        {
+            network.addConnection("user" + std::to_string(edge.first), "user" + std::to_string(edge.second));
+        }
+
+        std::vector<std::string> queries;
+        for (int i = 0; i < queryCount; ++i)
+        {
+            queries.push_back("user" + std::to_string(gen() % smallUsers));
+        }
+
+        size_t checksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const std::string &user : queries)
+        {
+            checksum += network.suggestConnections(user, 10).size();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        double mapMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+        start = std::chrono::high_resolution_clock::now();
+        network.buildSnapshot();
+        end = std::chrono::high_resolution_clock::now();
+        double buildMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+        start = std::chrono::high_resolution_clock::now();
+        for (const std::string &user : queries)
+        {
+            checksum += network.suggestConnections(user, 10).size();
+        }
+        end = std::chrono::high_resolution_clock::now();
+        double snapshotMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+        std::cout << "SocialNetwork, " << smallUsers << " users, " << smallEdges << " friendships, top-10 suggestions:" << std::endl;
+        std::cout << "  std::map scoring: " << queryCount / (mapMs / 1000.0) << " suggestions/sec" << std::endl;
+        std::cout << "  CSR snapshot:     " << queryCount / (snapshotMs / 1000.0) << " suggestions/sec"
+                  << " (snapshot built in " << buildMs << " ms, checksum " << checksum << ")" << std::endl;
+    }
+
+    // Large power-law graph straight into a snapshot
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::pair<int, int>> edges = generatePowerLawEdges(largeUsers, largeEdges, 2.3, 2);
+    SocialGraphSnapshot snapshot(largeUsers, edges);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::vector<std::pair<int, int>>().swap(edges);
+
+    std::cout << "Snapshot of " << largeUsers << " users, " << largeEdges << " drawn friendships: "
+              << snapshot.getArcCount() / 2 << " distinct, max degree " << snapshot.getDegree(0)
+              << ", " << snapshot.getHubCount() << " bitset hubs, built in "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+
+    // Random users, plus (fewer, as each one is far more work) users among the 1000 highest degrees
+    std::vector<int> randomUsers;
+    std::vector<int> hubUsers;
+    for (int i = 0; i < queryCount; ++i)
+    {
+        randomUsers.push_back(gen() % largeUsers);
+    }
+    for (int i = 0; i < std::max(1, queryCount / 10); ++i)
+    {
+        hubUsers.push_back(snapshot.toOriginalId(gen() % std::min(1000, largeUsers)));
+    }
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        const std::vector<int> &users = pass == 0 ? randomUsers : hubUsers;
+        start = std::chrono::high_resolution_clock::now();
+        auto results = snapshot.suggestBatch(users, 10);
+        end = std::chrono::high_resolution_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        std::cout << "  Top-10 suggestions, " << (pass == 0 ? "random users:   " : "top-1000 users: ")
+                  << users.size() / (ms / 1000.0) << " suggestions/sec (" << ms * 1000.0 / users.size()
+                  << " us each)" << std::endl;
+    }
+
+    // Mutual-friend counts between a random user and random / high-degree users
+    int64_t total = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < queryCount; ++i)
+    {
+        total += snapshot.mutualCount(randomUsers[i], hubUsers[i % hubUsers.size()]);
+        total += snapshot.mutualCount(hubUsers[i % hubUsers.size()], hubUsers[(i + 1) % hubUsers.size()]);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << "  Mutual-friend counts: " << 2.0 * queryCount / (ms / 1000.0) << " pairs/sec (checksum " << total << ")"
+              << std::endl
+              << std::endl;
+}
+
 /**
  * @brief A simple transportation network class using graphs
  */
@@ -3053,6 +3809,20 @@ void demoSocialNetwork()
         std::cout << std::endl;
     }
 
+    // Same query answered from a CSR snapshot (dropped again by the next change)
+    friendNetwork.buildSnapshot();
+    std::cout << "Friend suggestions for Alice (snapshot): ";
+    suggestions = friendNetwork.suggestConnections("Alice");
+    for (size_t i = 0; i < suggestions.size(); ++i)
+    {
+        std::cout << suggestions[i];
+        if (i < suggestions.size() - 1)
+        {
+            std::cout << ", ";
+        }
+    }
+    std::cout << (suggestions.empty() ? "None" : "") << std::endl;
+
     // Find a path between users
     std::cout << "Path from Alice to Eva: ";
     std::vector<std::string> path = friendNetwork.findPath("Alice", "Eva");
@@ -3286,9 +4056,13 @@ void demoGraphGeneration()
 
 /**
  * @brief Main function to demonstrate graph fundamentals
+ *
+ * Pass --large to run the social benchmark on the 1M-user, 10M-friendship graph.
  */
-int main()
+int main(int argc, char *argv[])
 {
+    bool runLarge = argc > 1 && std::string(argv[1]) == "--large";
+
     std::cout << "======================================================" << std::endl;
     std::cout << "=== DAY 29: GRAPH FUNDAMENTALS                     ===" << std::endl;
     std::cout << "=== Part of #DSAin45 Course                        ===" << std::endl;
@@ -3326,6 +4100,9 @@ int main()
     // Benchmark edge operations
     benchmarkEdgeOperations(1000, {0.01, 0.1, 0.5}, 3);
 
+    // Benchmark mutual-friend queries and suggestions (1M friendships, 10M with --large)
+    benchmarkSocialRecommendations(20000, 200000, runLarge ? 1000000 : 100000, runLarge ? 10000000 : 1000000, 2000);
+
     std::cout << "======================================================" << std::endl;
     std::cout << "=== End of DAY 29 Demonstrations                   ===" << std::endl;
     std::cout << "======================================================" << std::endl;
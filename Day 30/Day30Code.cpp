@@ -16,6 +16,15 @@
 #include <random>
 #include <fstream>
 #include <memory>
+#include <tuple>
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <cstdio>
 
 /**
  * @brief Comprehensive Graph Traversals Implementation for #DSAin45 Day 30
@@ -23,6 +32,10 @@
  * This file provides implementations of:
  * - BFS (Breadth-First Search)
  * - DFS (Depth-First Search) - recursive and iterative
+ * - Compressed sparse row (CSR) graph with allocation-free traversals
+ * - Direction-optimizing parallel BFS
+ * - Concurrent union-find and parallel connected components
+ * - Multi-worker web crawler with per-host politeness and a Bloom filter URL-seen test
  * - Various applications of graph traversals
  * - Performance benchmarks
  *
@@ -983,6 +996,447 @@ public:
     }
 };
 
+/**
+ * @brief Immutable graph in compressed sparse row (CSR) form
+ *
+ * Vertices are renumbered to dense indices 0..V-1. The out-edges of index i are
+ * targets[offsets[i]..offsets[i+1]) with matching weights, so an algorithm can walk
+ * a neighbor list as one contiguous range with no allocation and no hashing.
+ * Directed graphs also keep the reverse (in-edge) arrays.
+ *
+ * When built from another IGraph, dense index i is the i-th vertex of
+ * graph.getVertices(), so index-based results line up with the source graph.
+ * The IGraph mutators return false; clear() is the only operation that changes it.
+ */
+class CSRGraph : public IGraph
+{
+public:
+    /**
+     * @brief One edge as seen from its source: dense target index and weight
+     */
+    struct Neighbor
+    {
+        int target;
+        double weight;
+    };
+
+    /**
+     * @brief Zero-copy view of one vertex's neighbor list
+     */
+    class NeighborRange
+    {
+    public:
+        class Iterator
+        {
+        public:
+            Iterator(const int *t, const double *w) : target(t), weight(w) {}
+
+            Neighbor operator*() const { return {*target, *weight}; }
+            Iterator &operator++()
+            {
+                ++target;
+                ++weight;
+                return *this;
+            }
+            bool operator!=(const Iterator &other) const { return target != other.target; }
+
+        private:
+            const int *target;
+            const double *weight;
+        };
+
+        NeighborRange(const int *t, const double *w, size_t n) : targets(t), weights(w), count(n) {}
+
+        Iterator begin() const { return Iterator(targets, weights); }
+        Iterator end() const { return Iterator(targets + count, weights + count); }
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        Neighbor operator[](size_t i) const { return {targets[i], weights[i]}; }
+
+        // Raw arrays for loops that only need targets (e.g. BFS)
+        const int *targetData() const { return targets; }
+        const double *weightData() const { return weights; }
+
+    private:
+        const int *targets;
+        const double *weights;
+        size_t count;
+    };
+
+private:
+    bool directed;
+    bool weighted;
+    int edgeCount; // Edges as the source graph counts them (undirected edges once)
+
+    std::vector<size_t> offsets; // V + 1 row starts into targets/weights
+    std::vector<int> targets;    // Dense target indices
+    std::vector<double> weights; // Edge weights, parallel to targets
+
+    std::vector<size_t> inOffsets; // Reverse CSR (directed graphs only)
+    std::vector<int> inSources;
+    std::vector<double> inWeights;
+
+    std::vector<int> vertexIds;                // Dense index -> original vertex ID
+    std::unordered_map<int, int> indexOfVertex; // Original vertex ID -> dense index
+    bool identityIds = false;                   // IDs are 0..V-1 in order; indexOfVertex unused
+
+    /**
+     * @brief Build the reverse CSR from the forward arrays with a counting pass
+     */
+    void buildInEdges()
+    {
+        inOffsets.clear();
+        inSources.clear();
+        inWeights.clear();
+
+        if (!directed)
+        {
+            return; // In-edges are the out-edges
+        }
+
+        int n = static_cast<int>(vertexIds.size());
+        inOffsets.assign(n + 1, 0);
+        for (int t : targets)
+        {
+            inOffsets[t + 1]++;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            inOffsets[i + 1] += inOffsets[i];
+        }
+
+        inSources.resize(targets.size());
+        inWeights.resize(targets.size());
+        std::vector<size_t> next(inOffsets.begin(), inOffsets.end() - 1);
+        for (int u = 0; u < n; u++)
+        {
+            for (size_t e = offsets[u]; e < offsets[u + 1]; e++)
+            {
+                size_t slot = next[targets[e]]++;
+                inSources[slot] = u;
+                inWeights[slot] = weights[e];
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Snapshot any graph into CSR form
+     *
+     * Neighbor order is preserved, so traversals visit vertices in the same order
+     * as on the source graph.
+     *
+     * Time Complexity: O(V + E) plus the cost of the source graph's getEdgeWeight
+     */
+    explicit CSRGraph(const IGraph &graph)
+        : directed(graph.isDirected()), weighted(graph.isWeighted()), edgeCount(graph.getEdgeCount())
+    {
+        vertexIds = graph.getVertices();
+        int n = static_cast<int>(vertexIds.size());
+
+        indexOfVertex.reserve(n);
+        for (int i = 0; i < n; i++)
+        {
+            indexOfVertex[vertexIds[i]] = i;
+        }
+
+        offsets.assign(n + 1, 0);
+        for (int i = 0; i < n; i++)
+        {
+            std::vector<int> neighbors = graph.getNeighbors(vertexIds[i]);
+            offsets[i + 1] = offsets[i] + neighbors.size();
+
+            for (int v : neighbors)
+            {
+                targets.push_back(indexOfVertex[v]);
+                weights.push_back(graph.getEdgeWeight(vertexIds[i], v));
+            }
+        }
+
+        buildInEdges();
+    }
+
+    /**
+     * @brief Build directly from an edge list over vertices 0..numVertices-1
+     *
+     * Undirected edges are stored in both directions. Duplicate edges are kept
+     * as given, so callers should not pass any.
+     *
+     * Time Complexity: O(V + E) (counting sort by source)
+     */
+    CSRGraph(int numVertices, const std::vector<std::tuple<int, int, double>> &edges,
+             bool isDirected = false, bool isWeighted = true)
+        : directed(isDirected), weighted(isWeighted), edgeCount(static_cast<int>(edges.size())), identityIds(true)
+    {
+        vertexIds.resize(numVertices);
+        for (int i = 0; i < numVertices; i++)
+        {
+            vertexIds[i] = i;
+        }
+
+        offsets.assign(numVertices + 1, 0);
+        for (const auto &[u, v, w] : edges)
+        {
+            offsets[u + 1]++;
+            if (!directed && u != v)
+            {
+                offsets[v + 1]++;
+            }
+        }
+        for (int i = 0; i < numVertices; i++)
+        {
+            offsets[i + 1] += offsets[i];
+        }
+
+        targets.resize(offsets[numVertices]);
+        weights.resize(offsets[numVertices]);
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (const auto &[u, v, w] : edges)
+        {
+            double weight = weighted ? w : 1.0;
+            targets[next[u]] = v;
+            weights[next[u]++] = weight;
+            if (!directed && u != v)
+            {
+                targets[next[v]] = u;
+                weights[next[v]++] = weight;
+            }
+        }
+
+        buildInEdges();
+    }
+
+    // ----- CSR-specific API (dense indices) -----
+
+    /**
+     * @brief Dense index of an original vertex ID, or -1 if absent
+     */
+    int indexOf(int v) const
+    {
+        if (identityIds)
+        {
+            return v >= 0 && v < static_cast<int>(vertexIds.size()) ? v : -1;
+        }
+
+        auto it = indexOfVertex.find(v);
+        return it == indexOfVertex.end() ? -1 : it->second;
+    }
+
+    /**
+     * @brief Original vertex ID of a dense index
+     */
+    int vertexAt(int index) const
+    {
+        return vertexIds[index];
+    }
+
+    /**
+     * @brief Out-neighbors of a dense index as (target index, weight) pairs
+     */
+    NeighborRange neighbors(int index) const
+    {
+        size_t begin = offsets[index];
+        return NeighborRange(targets.data() + begin, weights.data() + begin, offsets[index + 1] - begin);
+    }
+
+    /**
+     * @brief In-neighbors of a dense index as (source index, weight) pairs
+     */
+    NeighborRange inNeighbors(int index) const
+    {
+        if (!directed)
+        {
+            return neighbors(index);
+        }
+
+        size_t begin = inOffsets[index];
+        return NeighborRange(inSources.data() + begin, inWeights.data() + begin, inOffsets[index + 1] - begin);
+    }
+
+    /**
+     * @brief Number of stored adjacency entries (2E for undirected graphs)
+     */
+    size_t adjacencyCount() const
+    {
+        return targets.size();
+    }
+
+    // ----- IGraph interface -----
+
+    bool isDirected() const override
+    {
+        return directed;
+    }
+
+    bool isWeighted() const override
+    {
+        return weighted;
+    }
+
+    int getVertexCount() const override
+    {
+        return static_cast<int>(vertexIds.size());
+    }
+
+    int getEdgeCount() const override
+    {
+        return edgeCount;
+    }
+
+    bool hasVertex(int v) const override
+    {
+        return indexOf(v) >= 0;
+    }
+
+    bool addVertex(int) override
+    {
+        return false; // Immutable
+    }
+
+    bool removeVertex(int) override
+    {
+        return false; // Immutable
+    }
+
+    std::vector<int> getVertices() const override
+    {
+        return vertexIds;
+    }
+
+    bool hasEdge(int from, int to) const override
+    {
+        int u = indexOf(from);
+        int v = indexOf(to);
+        if (u < 0 || v < 0)
+        {
+            return false;
+        }
+
+        for (Neighbor edge : neighbors(u))
+        {
+            if (edge.target == v)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool addEdge(int, int, double = 1.0) override
+    {
+        return false; // Immutable
+    }
+
+    bool removeEdge(int, int) override
+    {
+        return false; // Immutable
+    }
+
+    double getEdgeWeight(int from, int to) const override
+    {
+        int u = indexOf(from);
+        int v = indexOf(to);
+        if (u < 0 || v < 0)
+        {
+            return std::numeric_limits<double>::infinity();
+        }
+
+        for (Neighbor edge : neighbors(u))
+        {
+            if (edge.target == v)
+            {
+                return edge.weight;
+            }
+        }
+
+        return std::numeric_limits<double>::infinity(); // Edge doesn't exist
+    }
+
+    bool setEdgeWeight(int, int, double) override
+    {
+        return false; // Immutable
+    }
+
+    std::vector<int> getNeighbors(int v) const override
+    {
+        int u = indexOf(v);
+        if (u < 0)
+        {
+            return {};
+        }
+
+        std::vector<int> result;
+        result.reserve(offsets[u + 1] - offsets[u]);
+        for (Neighbor edge : neighbors(u))
+        {
+            result.push_back(vertexIds[edge.target]);
+        }
+
+        return result;
+    }
+
+    int getInDegree(int v) const override
+    {
+        int u = indexOf(v);
+        return u < 0 ? -1 : static_cast<int>(inNeighbors(u).size());
+    }
+
+    int getOutDegree(int v) const override
+    {
+        int u = indexOf(v);
+        return u < 0 ? -1 : static_cast<int>(neighbors(u).size());
+    }
+
+    /**
+     * @brief Release all storage, leaving an empty graph
+     */
+    void clear() override
+    {
+        offsets.assign(1, 0);
+        targets.clear();
+        weights.clear();
+        inOffsets.clear();
+        inSources.clear();
+        inWeights.clear();
+        vertexIds.clear();
+        indexOfVertex.clear();
+        identityIds = false;
+        edgeCount = 0;
+    }
+
+    std::string toString() const override
+    {
+        std::ostringstream oss;
+        oss << "CSR Graph (" << (directed ? "directed" : "undirected")
+            << ", " << (weighted ? "weighted" : "unweighted") << "):\n";
+        oss << "Vertices: " << vertexIds.size() << ", Edges: " << edgeCount << "\n\n";
+
+        for (int i = 0; i < static_cast<int>(vertexIds.size()); i++)
+        {
+            oss << vertexIds[i] << " -> [ ";
+            bool first = true;
+            for (Neighbor edge : neighbors(i))
+            {
+                if (!first)
+                {
+                    oss << ", ";
+                }
+                first = false;
+
+                oss << vertexIds[edge.target];
+                if (weighted)
+                {
+                    oss << "(" << edge.weight << ")";
+                }
+            }
+            oss << " ]\n";
+        }
+
+        return oss.str();
+    }
+};
+
 /****************************************************************************************
  * GRAPH TRAVERSAL ALGORITHMS
  ****************************************************************************************/
@@ -1063,25 +1517,86 @@ std::vector<int> BFS(const IGraph &graph, int startVertex, bool printOutput = tr
 }
 
 /**
- * @brief BFS traversal with path tracking
+ * @brief BFS over a CSR graph using the zero-copy neighbor ranges
  *
- * @param graph The graph to traverse
- * @param startVertex The vertex to start the traversal from
- * @return std::unordered_map<int, int> Map of vertices to their parent in the BFS tree
+ * Same traversal order as BFS on the source graph. The visited set is a byte
+ * per dense index and the queue is a flat vector, so the inner loop touches only
+ * contiguous arrays.
  *
- * This version of BFS keeps track of the parent of each vertex,
- * which can be used to reconstruct paths from the start vertex to any other vertex.
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V)
  */
-std::unordered_map<int, int> BFSWithPathTracking(const IGraph &graph, int startVertex)
+std::vector<int> BFS(const CSRGraph &graph, int startVertex, bool printOutput = true)
 {
-    std::unordered_map<int, int> parent; // Maps each vertex to its parent in the BFS tree
-    std::queue<int> queue;
-    std::unordered_set<int> visited;
-
-    // Check if the start vertex exists
-    if (!graph.hasVertex(startVertex))
+    int start = graph.indexOf(startVertex);
+    if (start < 0)
     {
-        return parent;
+        if (printOutput)
+        {
+            std::cout << "Start vertex " << startVertex << " does not exist in the graph." << std::endl;
+        }
+        return {};
+    }
+
+    std::vector<char> visited(graph.getVertexCount(), 0);
+    std::vector<int> queue; // Dense indices; queue[head..] is the pending part
+    queue.reserve(graph.getVertexCount());
+
+    visited[start] = 1;
+    queue.push_back(start);
+
+    for (size_t head = 0; head < queue.size(); head++)
+    {
+        for (CSRGraph::Neighbor edge : graph.neighbors(queue[head]))
+        {
+            if (!visited[edge.target])
+            {
+                visited[edge.target] = 1;
+                queue.push_back(edge.target);
+            }
+        }
+    }
+
+    // Translate back to original vertex IDs
+    std::vector<int> result(queue.size());
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        result[i] = graph.vertexAt(queue[i]);
+    }
+
+    if (printOutput)
+    {
+        std::cout << "BFS traversal (CSR) starting from vertex " << startVertex << ": ";
+        for (int v : result)
+        {
+            std::cout << v << " ";
+        }
+        std::cout << std::endl;
+    }
+
+    return result;
+}
+
+/**
+ * @brief BFS traversal with path tracking
+ *
+ * @param graph The graph to traverse
+ * @param startVertex The vertex to start the traversal from
+ * @return std::unordered_map<int, int> Map of vertices to their parent in the BFS tree
+ *
+ * This version of BFS keeps track of the parent of each vertex,
+ * which can be used to reconstruct paths from the start vertex to any other vertex.
+ */
+std::unordered_map<int, int> BFSWithPathTracking(const IGraph &graph, int startVertex)
+{
+    std::unordered_map<int, int> parent; // Maps each vertex to its parent in the BFS tree
+    std::queue<int> queue;
+    std::unordered_set<int> visited;
+
+    // Check if the start vertex exists
+    if (!graph.hasVertex(startVertex))
+    {
+        return parent;
     }
 
     // Mark the start vertex as visited and enqueue it
@@ -1302,6 +1817,68 @@ std::vector<int> DFSIterative(const IGraph &graph, int startVertex, bool printOu
     return result;
 }
 
+/**
+ * @brief Iterative DFS over a CSR graph using the zero-copy neighbor ranges
+ *
+ * Same traversal order as DFSIterative on the source graph.
+ *
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V + E) for the stack in the worst case
+ */
+std::vector<int> DFSIterative(const CSRGraph &graph, int startVertex, bool printOutput = true)
+{
+    int start = graph.indexOf(startVertex);
+    if (start < 0)
+    {
+        if (printOutput)
+        {
+            std::cout << "Start vertex " << startVertex << " does not exist in the graph." << std::endl;
+        }
+        return {};
+    }
+
+    std::vector<char> visited(graph.getVertexCount(), 0);
+    std::vector<int> stack = {start};
+    std::vector<int> result;
+
+    while (!stack.empty())
+    {
+        int current = stack.back();
+        stack.pop_back();
+
+        if (visited[current])
+        {
+            continue;
+        }
+
+        visited[current] = 1;
+        result.push_back(graph.vertexAt(current));
+
+        // Push in reverse so the first neighbor is explored first
+        CSRGraph::NeighborRange edges = graph.neighbors(current);
+        for (size_t i = edges.size(); i-- > 0;)
+        {
+            int next = edges.targetData()[i];
+            if (!visited[next])
+            {
+                stack.push_back(next);
+            }
+        }
+    }
+
+    if (printOutput)
+    {
+        std::cout << "DFS traversal (iterative, CSR) starting from vertex " << startVertex << ": ";
+        for (int v : result)
+        {
+            std::cout << v << " ";
+        }
+        std::cout << std::endl;
+    }
+
+    return result;
+}
+
 /**
  * @brief Iterative Deepening Depth-First Search (IDDFS)
  *
@@ -1516,6 +2093,307 @@ std::vector<int> bidirectionalBFS(const IGraph &graph, int start, int end)
     return path;
 }
 
+/**
+ * @brief Per-run statistics reported by parallelBFS
+ */
+struct ParallelBFSStats
+{
+    int levels = 0;              // Number of BFS levels expanded
+    int bottomUpLevels = 0;      // How many of them ran bottom-up
+    long long reached = 0;       // Vertices reached, including the start vertex
+    long long edgesTraversed = 0; // Edges in the reached component (Graph500 TEPS convention)
+};
+
+/**
+ * @brief Run body(threadId) on numThreads threads (the caller acts as thread 0)
+ */
+inline void runOnThreads(int numThreads, const std::function<void(int)> &body)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads - 1);
+    for (int t = 1; t < numThreads; t++)
+    {
+        workers.emplace_back(body, t);
+    }
+    body(0);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Level-synchronous, direction-optimizing parallel BFS (Beamer et al.)
+ *
+ * Each level is expanded either
+ * - top-down: threads scan the frontier's out-edges and claim unvisited
+ *   neighbors with a compare-and-swap on their parent entry, or
+ * - bottom-up: threads scan unvisited vertices and look for any in-neighbor in
+ *   the frontier bitmap, stopping at the first hit.
+ * Top-down switches to bottom-up when the frontier's out-edges exceed
+ * 1/alpha of the edges left to explore, and back once the frontier holds fewer
+ * than n/beta vertices. On low-diameter graphs (social networks, R-MAT) the
+ * few large middle levels then cost far fewer edge checks.
+ *
+ * The visited set and the bottom-up frontiers are bitmaps of 64-bit words.
+ *
+ * Time Complexity: O(V + E) work, O(diameter) synchronization rounds
+ * Space Complexity: O(V)
+ *
+ * @param graph The CSR graph (directed graphs use its reverse arrays bottom-up)
+ * @param startVertex Original ID of the start vertex
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @param stats Optional output statistics
+ * @return std::vector<int> BFS parent of each dense index (dense indices);
+ *         the start vertex is its own parent and unreached vertices have -1
+ */
+std::vector<int> parallelBFS(const CSRGraph &graph, int startVertex, int numThreads = 0,
+                             ParallelBFSStats *stats = nullptr)
+{
+    const int alpha = 14;
+    const int beta = 24;
+    const size_t topDownChunk = 64;  // Frontier vertices per work item
+    const size_t bottomUpChunk = 16; // Bitmap words (x64 vertices) per work item
+
+    int n = graph.getVertexCount();
+    int start = graph.indexOf(startVertex);
+    if (start < 0)
+    {
+        return {};
+    }
+
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    size_t words = (static_cast<size_t>(n) + 63) / 64;
+    std::vector<std::atomic<int>> parent(n);
+    std::vector<std::atomic<uint64_t>> visited(words);
+    std::vector<std::atomic<uint64_t>> frontierBits(words);
+    std::vector<std::atomic<uint64_t>> nextBits(words);
+    for (int i = 0; i < n; i++)
+    {
+        parent[i].store(-1, std::memory_order_relaxed);
+    }
+    for (size_t w = 0; w < words; w++)
+    {
+        visited[w].store(0, std::memory_order_relaxed);
+        frontierBits[w].store(0, std::memory_order_relaxed);
+        nextBits[w].store(0, std::memory_order_relaxed);
+    }
+
+    auto isSet = [](const std::vector<std::atomic<uint64_t>> &bits, int v)
+    {
+        return (bits[v >> 6].load(std::memory_order_relaxed) >> (v & 63)) & 1;
+    };
+
+    parent[start].store(start, std::memory_order_relaxed);
+    visited[start >> 6].fetch_or(uint64_t(1) << (start & 63), std::memory_order_relaxed);
+
+    std::vector<int> frontier = {start};
+    std::vector<std::vector<int>> localNext(numThreads);
+    long long frontierEdges = static_cast<long long>(graph.neighbors(start).size());
+    long long unexploredEdges = static_cast<long long>(graph.adjacencyCount()) - frontierEdges;
+    long long frontierSize = 1;
+    long long reached = 1;
+    long long reachedEdges = frontierEdges;
+    bool bottomUp = false;
+    int levels = 0;
+    int bottomUpLevels = 0;
+
+    while (frontierSize > 0)
+    {
+        // Beamer's direction heuristic
+        if (!bottomUp && frontierEdges > unexploredEdges / alpha)
+        {
+            bottomUp = true;
+            for (size_t w = 0; w < words; w++)
+            {
+                frontierBits[w].store(0, std::memory_order_relaxed);
+            }
+            for (int v : frontier)
+            {
+                frontierBits[v >> 6].fetch_or(uint64_t(1) << (v & 63), std::memory_order_relaxed);
+            }
+        }
+        else if (bottomUp && frontierSize < n / beta)
+        {
+            bottomUp = false;
+
+            // Convert the frontier bitmap back to a vertex list
+            frontier.clear();
+            for (size_t w = 0; w < words; w++)
+            {
+                uint64_t bits = frontierBits[w].load(std::memory_order_relaxed);
+                while (bits)
+                {
+                    frontier.push_back(static_cast<int>(w * 64 + __builtin_ctzll(bits)));
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+        std::atomic<size_t> nextItem(0);
+        std::vector<long long> localCount(numThreads, 0);
+        std::vector<long long> localEdges(numThreads, 0);
+
+        if (!bottomUp)
+        {
+            // Top-down: expand the frontier's out-edges, claim children by CAS
+            runOnThreads(numThreads, [&](int t)
+                         {
+                std::vector<int> &next = localNext[t];
+                next.clear();
+                long long edges = 0;
+
+                while (true)
+                {
+                    size_t begin = nextItem.fetch_add(topDownChunk);
+                    if (begin >= frontier.size())
+                    {
+                        break;
+                    }
+
+                    size_t end = std::min(frontier.size(), begin + topDownChunk);
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        int u = frontier[i];
+                        for (CSRGraph::Neighbor edge : graph.neighbors(u))
+                        {
+                            int v = edge.target;
+                            if (isSet(visited, v))
+                            {
+                                continue;
+                            }
+
+                            int expected = -1;
+                            if (parent[v].compare_exchange_strong(expected, u, std::memory_order_relaxed))
+                            {
+                                visited[v >> 6].fetch_or(uint64_t(1) << (v & 63), std::memory_order_relaxed);
+                                next.push_back(v);
+                                edges += static_cast<long long>(graph.neighbors(v).size());
+                            }
+                        }
+                    }
+                }
+
+                localEdges[t] = edges; });
+
+            size_t total = 0;
+            for (const auto &next : localNext)
+            {
+                total += next.size();
+            }
+            frontier.clear();
+            frontier.reserve(total);
+            for (const auto &next : localNext)
+            {
+                frontier.insert(frontier.end(), next.begin(), next.end());
+            }
+            frontierSize = static_cast<long long>(total);
+        }
+        else
+        {
+            // Bottom-up: every unvisited vertex looks for a parent in the frontier
+            runOnThreads(numThreads, [&](int t)
+                         {
+                long long count = 0;
+                long long edges = 0;
+
+                while (true)
+                {
+                    size_t begin = nextItem.fetch_add(bottomUpChunk);
+                    if (begin >= words)
+                    {
+                        break;
+                    }
+
+                    size_t end = std::min(words, begin + bottomUpChunk);
+                    for (size_t w = begin; w < end; w++)
+                    {
+                        uint64_t unvisited = ~visited[w].load(std::memory_order_relaxed);
+                        uint64_t found = 0;
+
+                        while (unvisited)
+                        {
+                            int bit = __builtin_ctzll(unvisited);
+                            unvisited &= unvisited - 1;
+                            int v = static_cast<int>(w * 64 + bit);
+                            if (v >= n)
+                            {
+                                break;
+                            }
+
+                            for (CSRGraph::Neighbor edge : graph.inNeighbors(v))
+                            {
+                                if (isSet(frontierBits, edge.target))
+                                {
+                                    parent[v].store(edge.target, std::memory_order_relaxed);
+                                    found |= uint64_t(1) << bit;
+                                    count++;
+                                    edges += static_cast<long long>(graph.neighbors(v).size());
+                                    break;
+                                }
+                            }
+                        }
+
+                        // Each word is owned by one thread, so plain stores suffice
+                        nextBits[w].store(found, std::memory_order_relaxed);
+                    }
+                }
+
+                localCount[t] = count;
+                localEdges[t] = edges; });
+
+            // The new level becomes visited and is the next frontier
+            for (size_t w = 0; w < words; w++)
+            {
+                uint64_t found = nextBits[w].load(std::memory_order_relaxed);
+                visited[w].store(visited[w].load(std::memory_order_relaxed) | found, std::memory_order_relaxed);
+                frontierBits[w].store(found, std::memory_order_relaxed);
+            }
+
+            frontierSize = 0;
+            for (long long count : localCount)
+            {
+                frontierSize += count;
+            }
+        }
+
+        if (bottomUp && frontierSize > 0)
+        {
+            bottomUpLevels++;
+        }
+
+        frontierEdges = 0;
+        for (long long edges : localEdges)
+        {
+            frontierEdges += edges;
+        }
+        unexploredEdges -= frontierEdges;
+        reached += frontierSize;
+        reachedEdges += frontierEdges;
+        levels++;
+    }
+
+    if (stats)
+    {
+        stats->levels = levels - 1; // The last round found nothing new
+        stats->bottomUpLevels = bottomUpLevels;
+        stats->reached = reached;
+        stats->edgesTraversed = graph.isDirected() ? reachedEdges : reachedEdges / 2;
+    }
+
+    std::vector<int> result(n);
+    for (int i = 0; i < n; i++)
+    {
+        result[i] = parent[i].load(std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
 /****************************************************************************************
  * GRAPH UTILITY FUNCTIONS
  ****************************************************************************************/
@@ -1697,50 +2575,293 @@ std::vector<std::vector<int>> findConnectedComponents(const IGraph &graph)
 }
 
 /**
- * @brief Perform topological sort on a directed acyclic graph (DAG)
+ * @brief Concurrent union-find over dense indices 0..n-1 (Jayanti-Tarjan style)
  *
- * @param graph The directed graph to sort
- * @return std::vector<int> Topologically sorted vertices, or empty if graph has a cycle
+ * Parent links are atomics, so any number of threads may call find and unite
+ * at the same time without locks:
+ * - find uses path splitting: every visited node is swung to its grandparent.
+ *   A non-root's parent only ever moves to another ancestor, so these writes
+ *   need no CAS and racing splits are harmless.
+ * - unite links by hashed priority: of two roots, the one with the lower
+ *   priority is CAS-ed below the other. The priority is a fixed pseudo-random
+ *   permutation of the index, which gives the randomized linking bound without
+ *   storing ranks.
+ *
+ * find never retries, and unite only retries when a competing unite changed one
+ * of the two roots, i.e. when the system as a whole made progress.
+ *
+ * Time Complexity: O(α(n)) expected amortized per operation with random linking
+ * Space Complexity: O(n)
  */
-std::vector<int> topologicalSort(const IGraph &graph)
+class ConcurrentUnionFind
 {
-    // Check if the graph is directed
-    if (!graph.isDirected())
+private:
+    mutable std::vector<std::atomic<int>> parent;
+
+    // Bijective 32-bit mix, used as the linking priority of an index
+    static uint32_t priority(int x)
     {
-        return {}; // Topological sort is only defined for directed graphs
+        uint32_t h = static_cast<uint32_t>(x);
+        h ^= h >> 16;
+        h *= 0x7feb352dU;
+        h ^= h >> 15;
+        h *= 0x846ca68bU;
+        h ^= h >> 16;
+        return h;
     }
 
-    // Check if the graph contains a cycle
-    if (isCyclic(graph))
+public:
+    /**
+     * @brief Create n singleton sets
+     */
+    explicit ConcurrentUnionFind(int n) : parent(n)
     {
-        return {}; // Topological sort is only defined for acyclic graphs
+        for (int i = 0; i < n; i++)
+        {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
     }
 
-    // Get all vertices
-    std::vector<int> vertices = graph.getVertices();
-
-    // Create a vector to store the sorted vertices
-    std::vector<int> sorted;
-
-    // Create a set to keep track of visited vertices
-    std::unordered_set<int> visited;
-
-    // DFS function to perform topological sort
-    std::function<void(int)> dfs = [&](int vertex)
+    /**
+     * @brief Find the root of the set containing x (path splitting)
+     */
+    int find(int x) const
     {
-        visited.insert(vertex);
-
-        for (int neighbor : graph.getNeighbors(vertex))
+        while (true)
         {
-            if (visited.find(neighbor) == visited.end())
+            int p = parent[x].load(std::memory_order_acquire);
+            if (p == x)
             {
-                dfs(neighbor);
+                return x;
+            }
+
+            int grandparent = parent[p].load(std::memory_order_acquire);
+            if (grandparent != p)
+            {
+                // x is not a root, so its parent only ever moves to another ancestor and a
+                // plain store cannot break the tree even if it races with another split
+                parent[x].store(grandparent, std::memory_order_release);
             }
+            x = p;
         }
+    }
 
-        // Add current vertex to sorted list (in reverse order)
-        sorted.push_back(vertex);
-    };
+    /**
+     * @brief Merge the sets containing x and y
+     *
+     * @return bool True if this call merged two different sets
+     */
+    bool unite(int x, int y)
+    {
+        while (true)
+        {
+            x = find(x);
+            y = find(y);
+            if (x == y)
+            {
+                return false;
+            }
+
+            // Link the root with the lower priority below the other one
+            if (priority(x) > priority(y))
+            {
+                std::swap(x, y);
+            }
+
+            int expected = x;
+            if (parent[x].compare_exchange_strong(expected, y, std::memory_order_acq_rel))
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Check if x and y are in the same set (linearizable under concurrent unites)
+     */
+    bool connected(int x, int y) const
+    {
+        while (true)
+        {
+            x = find(x);
+            y = find(y);
+            if (x == y)
+            {
+                return true;
+            }
+
+            // If x is still a root, the two sets were distinct at this point
+            if (parent[x].load(std::memory_order_acquire) == x)
+            {
+                return false;
+            }
+        }
+    }
+
+    int size() const { return static_cast<int>(parent.size()); }
+};
+
+/**
+ * @brief Connected components of an edge list, computed by concurrent unions
+ *
+ * The edge list is split into contiguous slices, one per thread, and every
+ * thread unites the endpoints of its edges in a shared ConcurrentUnionFind.
+ * A final parallel pass labels each vertex with its root.
+ *
+ * Time Complexity: O((V + E) α(V) / p) expected with p threads
+ * Space Complexity: O(V)
+ *
+ * @param numVertices Number of vertices (dense indices 0..numVertices-1)
+ * @param edges Undirected edges (u, v)
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @param numComponents Optional output for the number of components
+ * @return std::vector<int> Component label of each vertex (the root of its set)
+ */
+std::vector<int> parallelConnectedComponents(int numVertices,
+                                             const std::vector<std::pair<int, int>> &edges,
+                                             int numThreads = 0,
+                                             int *numComponents = nullptr)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    ConcurrentUnionFind sets(numVertices);
+    std::vector<int> label(numVertices);
+    std::vector<int> localRoots(numThreads, 0);
+    size_t m = edges.size();
+
+    runOnThreads(numThreads, [&](int t)
+                 {
+        for (size_t i = m * t / numThreads; i < m * (t + 1) / numThreads; i++)
+        {
+            sets.unite(edges[i].first, edges[i].second);
+        } });
+
+    runOnThreads(numThreads, [&](int t)
+                 {
+        size_t begin = static_cast<size_t>(numVertices) * t / numThreads;
+        size_t end = static_cast<size_t>(numVertices) * (t + 1) / numThreads;
+        for (size_t v = begin; v < end; v++)
+        {
+            label[v] = sets.find(v);
+            if (label[v] == static_cast<int>(v))
+            {
+                localRoots[t]++;
+            }
+        } });
+
+    if (numComponents)
+    {
+        *numComponents = 0;
+        for (int roots : localRoots)
+        {
+            *numComponents += roots;
+        }
+    }
+
+    return label;
+}
+
+/**
+ * @brief Parallel connected components of a CSR graph (weakly connected for directed graphs)
+ *
+ * Same result as findConnectedComponents (components may be listed in a different
+ * order), but without recursion and with the edge scan split across threads.
+ *
+ * @param graph The undirected CSR graph
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @return std::vector<std::vector<int>> Components as lists of original vertex IDs
+ */
+std::vector<std::vector<int>> findConnectedComponents(const CSRGraph &graph, int numThreads = 0)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    int n = graph.getVertexCount();
+    ConcurrentUnionFind sets(n);
+
+    // Each thread unites the edges of a contiguous block of vertices
+    runOnThreads(numThreads, [&](int t)
+                 {
+        int begin = static_cast<long long>(n) * t / numThreads;
+        int end = static_cast<long long>(n) * (t + 1) / numThreads;
+        for (int u = begin; u < end; u++)
+        {
+            for (const auto &neighbor : graph.neighbors(u))
+            {
+                if (graph.isDirected() || u < neighbor.target)
+                {
+                    sets.unite(u, neighbor.target);
+                }
+            }
+        } });
+
+    // Group vertices by root, in order of first appearance
+    std::vector<int> componentOf(n, -1);
+    std::vector<std::vector<int>> components;
+    for (int v = 0; v < n; v++)
+    {
+        int root = sets.find(v);
+        if (componentOf[root] == -1)
+        {
+            componentOf[root] = components.size();
+            components.emplace_back();
+        }
+        components[componentOf[root]].push_back(graph.vertexAt(v));
+    }
+
+    return components;
+}
+
+/**
+ * @brief Perform topological sort on a directed acyclic graph (DAG)
+ *
+ * @param graph The directed graph to sort
+ * @return std::vector<int> Topologically sorted vertices, or empty if graph has a cycle
+ */
+std::vector<int> topologicalSort(const IGraph &graph)
+{
+    // Check if the graph is directed
+    if (!graph.isDirected())
+    {
+        return {}; // Topological sort is only defined for directed graphs
+    }
+
+    // Check if the graph contains a cycle
+    if (isCyclic(graph))
+    {
+        return {}; // Topological sort is only defined for acyclic graphs
+    }
+
+    // Get all vertices
+    std::vector<int> vertices = graph.getVertices();
+
+    // Create a vector to store the sorted vertices
+    std::vector<int> sorted;
+
+    // Create a set to keep track of visited vertices
+    std::unordered_set<int> visited;
+
+    // DFS function to perform topological sort
+    std::function<void(int)> dfs = [&](int vertex)
+    {
+        visited.insert(vertex);
+
+        for (int neighbor : graph.getNeighbors(vertex))
+        {
+            if (visited.find(neighbor) == visited.end())
+            {
+                dfs(neighbor);
+            }
+        }
+
+        // Add current vertex to sorted list (in reverse order)
+        sorted.push_back(vertex);
+    };
 
     // Perform DFS on all vertices
     for (int v : vertices)
@@ -1849,6 +2970,124 @@ std::vector<int> findArticulationPoints(const IGraph &graph)
     return std::vector<int>(articulationPoints.begin(), articulationPoints.end());
 }
 
+/**
+ * @brief Random graph models supported by generateRandomGraph
+ */
+enum class GraphModel
+{
+    ErdosRenyi, // Every vertex pair is an edge with the same probability
+    RMAT        // Recursive matrix model: skewed, low-diameter, social-network-like
+};
+
+/**
+ * @brief Generate an R-MAT edge list (Chakrabarti, Zhan, Faloutsos)
+ *
+ * Each edge picks its (row, column) cell by descending the adjacency matrix
+ * quadrant by quadrant with probabilities a, b, c, d (Graph500 defaults). This
+ * yields a power-law degree distribution and a small diameter. Vertex labels
+ * are randomly permuted so high-degree vertices are not clustered at low IDs.
+ * Self-loops and duplicate edges are dropped; if the model saturates, fewer
+ * than numEdges edges are returned.
+ *
+ * @param numVertices Number of vertices (IDs 0..numVertices-1)
+ * @param numEdges Target number of distinct edges
+ * @param directed Whether (u, v) and (v, u) are different edges
+ * @param minWeight Minimum edge weight
+ * @param maxWeight Maximum edge weight
+ * @param seed Random seed
+ * @return std::vector<std::tuple<int, int, double>> Edges as (from, to, weight)
+ */
+std::vector<std::tuple<int, int, double>> generateRMATEdgeList(
+    int numVertices,
+    long long numEdges,
+    bool directed = false,
+    double minWeight = 1.0,
+    double maxWeight = 10.0,
+    unsigned seed = 42)
+{
+    const double a = 0.57, b = 0.19, c = 0.19; // d = 0.05
+
+    int scale = 0;
+    while ((1LL << scale) < numVertices)
+    {
+        scale++;
+    }
+
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    std::uniform_real_distribution<double> weightDist(minWeight, maxWeight);
+
+    std::vector<int> label(numVertices);
+    for (int i = 0; i < numVertices; i++)
+    {
+        label[i] = i;
+    }
+    std::shuffle(label.begin(), label.end(), gen);
+
+    std::vector<uint64_t> keys;
+    keys.reserve(numEdges);
+    while (static_cast<long long>(keys.size()) < numEdges)
+    {
+        size_t before = keys.size();
+        long long missing = numEdges - static_cast<long long>(keys.size());
+
+        for (long long e = 0; e < missing; e++)
+        {
+            long long u = 0, v = 0;
+            for (int bit = 0; bit < scale; bit++)
+            {
+                double r = unit(gen);
+                if (r >= a + b + c)
+                {
+                    u |= 1LL << bit;
+                    v |= 1LL << bit;
+                }
+                else if (r >= a + b)
+                {
+                    u |= 1LL << bit;
+                }
+                else if (r >= a)
+                {
+                    v |= 1LL << bit;
+                }
+            }
+
+            if (u >= numVertices || v >= numVertices || u == v)
+                continue;
+
+            int from = label[u];
+            int to = label[v];
+            if (!directed && from > to)
+                std::swap(from, to);
+            keys.push_back((static_cast<uint64_t>(from) << 32) | static_cast<uint32_t>(to));
+        }
+
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        // Stop if the skewed distribution keeps producing only duplicates
+        if (keys.size() <= before + static_cast<size_t>(missing / 100))
+        {
+            break;
+        }
+    }
+
+    std::shuffle(keys.begin(), keys.end(), gen);
+    if (static_cast<long long>(keys.size()) > numEdges)
+    {
+        keys.resize(numEdges);
+    }
+
+    std::vector<std::tuple<int, int, double>> edges;
+    edges.reserve(keys.size());
+    for (uint64_t key : keys)
+    {
+        edges.emplace_back(static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFFu), weightDist(gen));
+    }
+
+    return edges;
+}
+
 /**
  * @brief Generate a random graph
  *
@@ -1858,6 +3097,8 @@ std::vector<int> findArticulationPoints(const IGraph &graph)
  * @param weighted Whether the graph is weighted
  * @param minWeight Minimum edge weight (for weighted graphs)
  * @param maxWeight Maximum edge weight (for weighted graphs)
+ * @param model Random graph model; RMAT draws the same expected number of edges
+ *              as ErdosRenyi but with a skewed degree distribution
  * @return std::unique_ptr<IGraph> Pointer to the generated graph
  */
 std::unique_ptr<IGraph> generateRandomGraph(
@@ -1866,7 +3107,8 @@ std::unique_ptr<IGraph> generateRandomGraph(
     bool directed = false,
     bool weighted = true,
     double minWeight = 1.0,
-    double maxWeight = 10.0)
+    double maxWeight = 10.0,
+    GraphModel model = GraphModel::ErdosRenyi)
 {
     // Create a new graph
     std::unique_ptr<IGraph> graph = std::make_unique<AdjacencyListGraph>(directed, weighted);
@@ -1883,6 +3125,19 @@ std::unique_ptr<IGraph> generateRandomGraph(
     std::uniform_real_distribution<double> edgeDist(0.0, 1.0);
     std::uniform_real_distribution<double> weightDist(minWeight, maxWeight);
 
+    if (model == GraphModel::RMAT)
+    {
+        long long pairs = static_cast<long long>(numVertices) * (numVertices - 1) / (directed ? 1 : 2);
+        long long numEdges = static_cast<long long>(std::llround(edgeProbability * pairs));
+
+        for (const auto &[u, v, w] : generateRMATEdgeList(numVertices, numEdges, directed, minWeight, maxWeight, rd()))
+        {
+            graph->addEdge(u, v, weighted ? w : 1.0);
+        }
+
+        return graph;
+    }
+
     // Add edges
     for (int i = 0; i < numVertices; i++)
     {
@@ -1907,6 +3162,76 @@ std::unique_ptr<IGraph> generateRandomGraph(
     return graph;
 }
 
+/**
+ * @brief Generate a sparse random edge list with a fixed number of edges
+ *
+ * Unlike generateRandomGraph, which tests every vertex pair (O(V^2)), this draws
+ * numEdges distinct edges directly, so it scales to millions of edges.
+ * Self-loops and duplicate edges are excluded.
+ *
+ * @param numVertices Number of vertices (IDs 0..numVertices-1)
+ * @param numEdges Number of distinct edges to generate
+ * @param directed Whether (u, v) and (v, u) are different edges
+ * @param minWeight Minimum edge weight
+ * @param maxWeight Maximum edge weight
+ * @param seed Random seed, so both graph representations can be built from the same edges
+ * @return std::vector<std::tuple<int, int, double>> Edges as (from, to, weight)
+ */
+std::vector<std::tuple<int, int, double>> generateRandomEdgeList(
+    int numVertices,
+    long long numEdges,
+    bool directed = false,
+    double minWeight = 1.0,
+    double maxWeight = 10.0,
+    unsigned seed = 42)
+{
+    // Only n(n-1) distinct edges exist (half that if undirected); asking for more
+    // would make the deduplication loop below run forever
+    long long n = std::max(numVertices, 0);
+    long long maxEdges = directed ? n * (n - 1) : n * (n - 1) / 2;
+    numEdges = std::max(0LL, std::min(numEdges, maxEdges));
+    if (numEdges == 0)
+    {
+        return {};
+    }
+
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<int> vertexDist(0, numVertices - 1);
+    std::uniform_real_distribution<double> weightDist(minWeight, maxWeight);
+
+    // Encode each edge as one 64-bit key so duplicates can be removed by sorting
+    std::vector<uint64_t> keys;
+    keys.reserve(numEdges);
+    while (static_cast<long long>(keys.size()) < numEdges)
+    {
+        while (static_cast<long long>(keys.size()) < numEdges)
+        {
+            int u = vertexDist(gen);
+            int v = vertexDist(gen);
+            if (u == v)
+                continue;
+            if (!directed && u > v)
+                std::swap(u, v);
+            keys.push_back((static_cast<uint64_t>(u) << 32) | static_cast<uint32_t>(v));
+        }
+
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+
+    // Sorting grouped the edges by source; shuffle so insertion order is random again
+    std::shuffle(keys.begin(), keys.end(), gen);
+
+    std::vector<std::tuple<int, int, double>> edges;
+    edges.reserve(keys.size());
+    for (uint64_t key : keys)
+    {
+        edges.emplace_back(static_cast<int>(key >> 32), static_cast<int>(key & 0xFFFFFFFFu), weightDist(gen));
+    }
+
+    return edges;
+}
+
 /****************************************************************************************
  * APPLICATIONS OF GRAPH TRAVERSAL
  ****************************************************************************************/
@@ -1943,6 +3268,25 @@ std::pair<std::vector<int>, int> shortestPathBFS(const IGraph &graph, int start,
     return {path, path.empty() ? -1 : static_cast<int>(path.size() - 1)};
 }
 
+/**
+ * @brief Small simulated web used by the crawler examples (URL -> links on that page)
+ */
+std::unordered_map<std::string, std::vector<std::string>> sampleWebGraph()
+{
+    return {
+        {"https://example.com", {"https://example.com/about", "https://example.com/products", "https://blog.example.com"}},
+        {"https://example.com/about", {"https://example.com", "https://example.com/contact"}},
+        {"https://example.com/products", {"https://example.com", "https://example.com/product/1", "https://example.com/product/2"}},
+        {"https://example.com/product/1", {"https://example.com/products", "https://example.com/checkout"}},
+        {"https://example.com/product/2", {"https://example.com/products", "https://example.com/checkout"}},
+        {"https://example.com/contact", {"https://example.com"}},
+        {"https://example.com/checkout", {"https://example.com", "https://example.com/products"}},
+        {"https://blog.example.com", {"https://example.com", "https://blog.example.com/post/1", "https://blog.example.com/post/2"}},
+        {"https://blog.example.com/post/1", {"https://blog.example.com"}},
+        {"https://blog.example.com/post/2", {"https://blog.example.com"}},
+    };
+}
+
 /**
  * @brief Implement a simple web crawler using BFS
  *
@@ -1958,18 +3302,7 @@ std::vector<std::string> webCrawlerBFS(const std::string &startUrl, int maxPages
     // For this example, we'll simulate it with a predefined link structure
 
     // Simulated web structure (URL -> list of links on that page)
-    std::unordered_map<std::string, std::vector<std::string>> webGraph = {
-        {"https://example.com", {"https://example.com/about", "https://example.com/products", "https://blog.example.com"}},
-        {"https://example.com/about", {"https://example.com", "https://example.com/contact"}},
-        {"https://example.com/products", {"https://example.com", "https://example.com/product/1", "https://example.com/product/2"}},
-        {"https://example.com/product/1", {"https://example.com/products", "https://example.com/checkout"}},
-        {"https://example.com/product/2", {"https://example.com/products", "https://example.com/checkout"}},
-        {"https://example.com/contact", {"https://example.com"}},
-        {"https://example.com/checkout", {"https://example.com", "https://example.com/products"}},
-        {"https://blog.example.com", {"https://example.com", "https://blog.example.com/post/1", "https://blog.example.com/post/2"}},
-        {"https://blog.example.com/post/1", {"https://blog.example.com"}},
-        {"https://blog.example.com/post/2", {"https://blog.example.com"}},
-    };
+    std::unordered_map<std::string, std::vector<std::string>> webGraph = sampleWebGraph();
 
     // Queue for BFS
     std::queue<std::string> queue;
@@ -1977,45 +3310,556 @@ std::vector<std::string> webCrawlerBFS(const std::string &startUrl, int maxPages
     // Set of visited URLs
     std::unordered_set<std::string> visited;
 
-    // Result vector
-    std::vector<std::string> result;
+    // Result vector
+    std::vector<std::string> result;
+
+    // Start crawling
+    queue.push(startUrl);
+    visited.insert(startUrl);
+
+    int pageCount = 0;
+
+    std::cout << "Web Crawler starting from " << startUrl << std::endl;
+
+    while (!queue.empty() && pageCount < maxPages)
+    {
+        std::string current = queue.front();
+        queue.pop();
+
+        // Process the page
+        std::cout << "Crawling: " << current << std::endl;
+        result.push_back(current);
+        pageCount++;
+
+        // Get links from the page
+        if (webGraph.find(current) != webGraph.end())
+        {
+            for (const std::string &link : webGraph[current])
+            {
+                if (visited.find(link) == visited.end())
+                {
+                    visited.insert(link);
+                    queue.push(link);
+                }
+            }
+        }
+    }
+
+    std::cout << "Crawling completed. Visited " << pageCount << " pages." << std::endl;
+
+    return result;
+}
+
+/**
+ * @brief Interface for fetching a page and extracting its links
+ *
+ * Implementations must be safe to call from several crawler workers at once.
+ */
+class PageFetcher
+{
+public:
+    /**
+     * @brief Fetch a page and return the links found on it
+     *
+     * @param url Page to fetch
+     * @param links Output: links found on the page
+     * @return bool False if the page could not be fetched
+     */
+    virtual bool fetch(const std::string &url, std::vector<std::string> &links) = 0;
+
+    virtual ~PageFetcher() {}
+};
+
+/**
+ * @brief Local stand-in for an HTTP fetcher
+ *
+ * Links come from a caller-supplied source (a fixed map, a generated web, ...).
+ * Every fetch blocks for latency +/- jitter to imitate a network round trip.
+ * The jitter is derived from a hash of the URL, so no shared RNG is needed.
+ */
+class SimulatedFetcher : public PageFetcher
+{
+public:
+    using LinkSource = std::function<bool(const std::string &, std::vector<std::string> &)>;
+
+private:
+    LinkSource source;
+    std::chrono::microseconds latency;
+    std::chrono::microseconds jitter;
+    std::atomic<long long> fetches{0};
+
+public:
+    /**
+     * @param linkSource Returns the links of a URL, or false for a missing page
+     * @param latency Mean simulated latency per fetch
+     * @param jitter Maximum deviation from the mean latency
+     */
+    SimulatedFetcher(LinkSource linkSource, std::chrono::microseconds latency,
+                     std::chrono::microseconds jitter = std::chrono::microseconds(0))
+        : source(std::move(linkSource)), latency(latency), jitter(jitter) {}
+
+    /**
+     * @brief Serve the links of a page from a fixed URL -> links map
+     */
+    static LinkSource fromMap(std::unordered_map<std::string, std::vector<std::string>> pages)
+    {
+        auto shared = std::make_shared<const std::unordered_map<std::string, std::vector<std::string>>>(std::move(pages));
+        return [shared](const std::string &url, std::vector<std::string> &links)
+        {
+            auto it = shared->find(url);
+            if (it == shared->end())
+            {
+                return false;
+            }
+            links = it->second;
+            return true;
+        };
+    }
+
+    /**
+     * @brief Generate a synthetic web of http://h<host>.test/p<page> URLs
+     *
+     * Every page links to linksPerPage pages chosen by a hash of the page. A share
+     * sameHostShare of the links stays on the same host, which is typical of real
+     * sites.
+     */
+    static LinkSource syntheticWeb(int numHosts, int pagesPerHost, int linksPerPage, double sameHostShare = 0.8)
+    {
+        return [=](const std::string &url, std::vector<std::string> &links)
+        {
+            int host = 0;
+            int page = 0;
+            if (std::sscanf(url.c_str(), "http://h%d.test/p%d", &host, &page) != 2 ||
+                host < 0 || host >= numHosts || page < 0 || page >= pagesPerHost)
+            {
+                return false;
+            }
+
+            uint64_t state = (static_cast<uint64_t>(host) << 32) | static_cast<uint32_t>(page);
+            links.clear();
+            for (int i = 0; i < linksPerPage; i++)
+            {
+                // splitmix64 step
+                state += 0x9e3779b97f4a7c15ULL;
+                uint64_t z = state;
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+                z ^= z >> 31;
+
+                bool sameHost = (z & 0xffff) < sameHostShare * 65536.0;
+                int targetHost = sameHost ? host : static_cast<int>((z >> 16) % numHosts);
+                int targetPage = static_cast<int>((z >> 40) % pagesPerHost);
+                links.push_back("http://h" + std::to_string(targetHost) + ".test/p" + std::to_string(targetPage));
+            }
+            return true;
+        };
+    }
+
+    bool fetch(const std::string &url, std::vector<std::string> &links) override
+    {
+        fetches.fetch_add(1, std::memory_order_relaxed);
+
+        auto delay = latency;
+        if (jitter.count() > 0)
+        {
+            long long span = 2 * jitter.count() + 1;
+            delay += std::chrono::microseconds(static_cast<long long>(std::hash<std::string>()(url) % span) - jitter.count());
+        }
+        if (delay.count() > 0)
+        {
+            std::this_thread::sleep_for(delay);
+        }
+
+        links.clear();
+        return source(url, links);
+    }
+
+    long long fetchCount() const { return fetches.load(); }
+};
+
+/**
+ * @brief Thread-safe URL-seen test: Bloom filter plus a 64-bit fingerprint set
+ *
+ * A URL is reduced to a 64-bit fingerprint. Two different URLs share one with
+ * probability about n^2 / 2^65.
+ * - The Bloom filter uses atomic words and takes no locks. It needs about
+ *   bitsPerUrl bits per URL.
+ * - The exact set is an open-addressing table of fingerprints, split into
+ *   mutex-protected shards. It stores 8 bytes per URL instead of a string.
+ * In exact mode the set has the final say. The filter then counts how often it
+ * reported "maybe seen" for a new URL: those are the pages a Bloom-only crawler
+ * would skip. Bloom-only mode drops the set to save memory, accepts that loss,
+ * and may rarely admit a URL twice when two workers race on it.
+ */
+class UrlSeenFilter
+{
+private:
+    static const int SHARD_BITS = 6;
+
+    struct Shard
+    {
+        std::mutex lock;
+        std::vector<uint64_t> slots; // 0 marks an empty slot
+        size_t size = 0;
+    };
+
+    std::unique_ptr<std::atomic<uint64_t>[]> bloomWords;
+    uint64_t bloomBits;
+    int bloomHashes;
+    bool exact;
+    std::vector<Shard> shards;
+
+    std::atomic<long long> bloomNegatives{0};
+    std::atomic<long long> bloomFalsePositives{0};
+
+    /**
+     * @brief Insert into a shard's table; false if the fingerprint was present
+     */
+    static bool insertFingerprint(Shard &shard, uint64_t fingerprint)
+    {
+        if (2 * (shard.size + 1) > shard.slots.size())
+        {
+            std::vector<uint64_t> old(std::max<size_t>(64, 2 * shard.slots.size()), 0);
+            old.swap(shard.slots);
+            for (uint64_t value : old)
+            {
+                if (value != 0)
+                {
+                    size_t mask = shard.slots.size() - 1;
+                    size_t i = value & mask;
+                    while (shard.slots[i] != 0)
+                    {
+                        i = (i + 1) & mask;
+                    }
+                    shard.slots[i] = value;
+                }
+            }
+        }
+
+        size_t mask = shard.slots.size() - 1;
+        size_t i = fingerprint & mask;
+        while (shard.slots[i] != 0)
+        {
+            if (shard.slots[i] == fingerprint)
+            {
+                return false;
+            }
+            i = (i + 1) & mask;
+        }
+        shard.slots[i] = fingerprint;
+        shard.size++;
+        return true;
+    }
+
+public:
+    /**
+     * @param expectedUrls Number of URLs the Bloom filter is sized for
+     * @param bitsPerUrl Bloom filter bits per expected URL (10 gives about 1% false positives)
+     * @param exactSet Keep the fingerprint set (false = Bloom filter only)
+     */
+    explicit UrlSeenFilter(size_t expectedUrls, int bitsPerUrl = 10, bool exactSet = true)
+        : exact(exactSet), shards(exactSet ? 1 << SHARD_BITS : 0)
+    {
+        uint64_t words = std::max<uint64_t>(1, (static_cast<uint64_t>(expectedUrls) * bitsPerUrl + 63) / 64);
+        bloomBits = words * 64;
+        bloomHashes = std::max(1, static_cast<int>(std::lround(bitsPerUrl * 0.693)));
+        bloomWords.reset(new std::atomic<uint64_t>[words]);
+        for (uint64_t i = 0; i < words; i++)
+        {
+            bloomWords[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 64-bit URL fingerprint (FNV-1a followed by a murmur3 finalizer, never 0)
+     */
+    static uint64_t fingerprint(const std::string &url)
+    {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (unsigned char c : url)
+        {
+            h = (h ^ c) * 0x100000001b3ULL;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h == 0 ? 1 : h;
+    }
+
+    /**
+     * @brief Record a URL
+     *
+     * @return bool True if the URL had not been seen before
+     */
+    bool insertIfNew(const std::string &url)
+    {
+        uint64_t fp = fingerprint(url);
+
+        // Bloom probe and insert (Kirsch-Mitzenmacher double hashing)
+        uint64_t h1 = fp;
+        uint64_t h2 = (fp >> 32) | (fp << 32) | 1;
+        bool maybeSeen = true;
+        for (int i = 0; i < bloomHashes; i++)
+        {
+            uint64_t bit = (h1 + i * h2) % bloomBits;
+            uint64_t mask = uint64_t(1) << (bit & 63);
+            std::atomic<uint64_t> &word = bloomWords[bit >> 6];
+            if ((word.load(std::memory_order_relaxed) & mask) == 0 &&
+                (word.fetch_or(mask, std::memory_order_relaxed) & mask) == 0)
+            {
+                maybeSeen = false;
+            }
+        }
+
+        if (!exact)
+        {
+            return !maybeSeen;
+        }
+
+        // The exact set decides; the shard comes from the top bits, the slot from the low bits
+        Shard &shard = shards[fp >> (64 - SHARD_BITS)];
+        bool isNew;
+        {
+            std::lock_guard<std::mutex> guard(shard.lock);
+            isNew = insertFingerprint(shard, fp);
+        }
+
+        if (!maybeSeen)
+        {
+            bloomNegatives.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if (isNew)
+        {
+            bloomFalsePositives.fetch_add(1, std::memory_order_relaxed);
+        }
+        return isNew;
+    }
+
+    long long bloomNegativeCount() const { return bloomNegatives.load(); }
+    long long bloomFalsePositiveCount() const { return bloomFalsePositives.load(); }
+};
+
+/**
+ * @brief Settings of ConcurrentCrawler
+ */
+struct CrawlerConfig
+{
+    int workers = 8;                              // Concurrent fetches
+    int maxPages = 1000;                          // Stop after this many fetches
+    std::chrono::microseconds politenessDelay{0}; // Gap between two fetches from one host
+    size_t expectedUrls = 1 << 20;                // Sizing hint for the URL-seen filter
+    bool exactSeenTest = true;                    // false = Bloom filter only
+};
+
+/**
+ * @brief Statistics of one crawl
+ */
+struct CrawlStats
+{
+    int pagesFetched = 0;    // Fetch attempts, including failures
+    int fetchFailures = 0;   // Pages the fetcher could not return
+    long long linksSeen = 0; // Links extracted from fetched pages
+    long long newUrls = 0;   // Links that passed the URL-seen test
+    int hosts = 0;           // Distinct hosts in the frontier
+    double seconds = 0;
+
+    double pagesPerSecond() const { return seconds > 0 ? pagesFetched / seconds : 0; }
+};
+
+/**
+ * @brief Multi-worker web crawler with per-host politeness
+ *
+ * The frontier keeps one FIFO queue per host plus a min-heap of hosts ordered by
+ * the time they may next be contacted. A worker takes the earliest host whose
+ * time has come, and that host leaves the heap until its fetch completes. So
+ * there is never more than one request in flight per host, and consecutive
+ * requests to a host are at least politenessDelay apart. Fetching and link
+ * filtering run outside the frontier lock; only queue updates hold it.
+ * Crawling is breadth-first within each host.
+ */
+class ConcurrentCrawler
+{
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct HostQueue
+    {
+        std::deque<std::string> urls;
+        Clock::time_point nextAllowed;
+        bool busy = false;      // A fetch for this host is in flight
+        bool scheduled = false; // The host is in the ready heap
+    };
+
+    PageFetcher &fetcher;
+    CrawlerConfig config;
+    UrlSeenFilter seen;
+
+    std::mutex frontierLock;
+    std::condition_variable frontierChanged;
+    std::unordered_map<std::string, int> hostIds;
+    std::vector<HostQueue> hostQueues;
+    std::priority_queue<std::pair<Clock::time_point, int>,
+                        std::vector<std::pair<Clock::time_point, int>>,
+                        std::greater<std::pair<Clock::time_point, int>>>
+        readyHosts;
+    int inFlight = 0;
+    int pagesStarted = 0;
+
+    std::vector<std::string> crawled;
+    CrawlStats stats;
+
+    /**
+     * @brief Host part of a URL ("https://a.b/c" -> "a.b")
+     */
+    static std::string hostOf(const std::string &url)
+    {
+        size_t begin = url.find("://");
+        begin = begin == std::string::npos ? 0 : begin + 3;
+        size_t end = url.find_first_of("/?#", begin);
+        return url.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+    }
+
+    /**
+     * @brief Add a URL to its host queue (frontier lock held)
+     */
+    void enqueue(const std::string &url)
+    {
+        std::string host = hostOf(url);
+        auto it = hostIds.find(host);
+        if (it == hostIds.end())
+        {
+            it = hostIds.emplace(host, static_cast<int>(hostQueues.size())).first;
+            hostQueues.emplace_back();
+        }
+
+        int id = it->second;
+        HostQueue &queue = hostQueues[id];
+        queue.urls.push_back(url);
+        if (!queue.busy && !queue.scheduled)
+        {
+            queue.scheduled = true;
+            readyHosts.push({queue.nextAllowed, id});
+        }
+    }
+
+    void workerLoop()
+    {
+        std::vector<std::string> links;
+        std::vector<std::string> fresh;
+        std::unique_lock<std::mutex> guard(frontierLock);
+
+        while (true)
+        {
+            if (pagesStarted >= config.maxPages || (readyHosts.empty() && inFlight == 0))
+            {
+                frontierChanged.notify_all();
+                return;
+            }
+            if (readyHosts.empty())
+            {
+                frontierChanged.wait(guard);
+                continue;
+            }
 
-    // Start crawling
-    queue.push(startUrl);
-    visited.insert(startUrl);
+            auto [allowedAt, host] = readyHosts.top();
+            if (allowedAt > Clock::now())
+            {
+                frontierChanged.wait_until(guard, allowedAt);
+                continue;
+            }
 
-    int pageCount = 0;
+            readyHosts.pop();
+            HostQueue &queue = hostQueues[host];
+            std::string url = std::move(queue.urls.front());
+            queue.urls.pop_front();
+            queue.scheduled = false;
+            queue.busy = true;
+            inFlight++;
+            pagesStarted++;
+            guard.unlock();
+
+            // Network round trip and duplicate filtering, without the lock
+            bool ok = fetcher.fetch(url, links);
+            fresh.clear();
+            if (ok)
+            {
+                for (const std::string &link : links)
+                {
+                    if (seen.insertIfNew(link))
+                    {
+                        fresh.push_back(link);
+                    }
+                }
+            }
 
-    std::cout << "Web Crawler starting from " << startUrl << std::endl;
+            guard.lock();
+            crawled.push_back(std::move(url));
+            stats.pagesFetched++;
+            stats.fetchFailures += ok ? 0 : 1;
+            stats.linksSeen += ok ? static_cast<long long>(links.size()) : 0;
+            stats.newUrls += static_cast<long long>(fresh.size());
+            for (const std::string &link : fresh)
+            {
+                enqueue(link);
+            }
 
-    while (!queue.empty() && pageCount < maxPages)
-    {
-        std::string current = queue.front();
-        queue.pop();
+            // hostQueues may have grown, so look the host up again
+            HostQueue &done = hostQueues[host];
+            done.busy = false;
+            done.nextAllowed = Clock::now() + config.politenessDelay;
+            if (!done.urls.empty())
+            {
+                done.scheduled = true;
+                readyHosts.push({done.nextAllowed, host});
+            }
+            inFlight--;
+            frontierChanged.notify_all();
+        }
+    }
 
-        // Process the page
-        std::cout << "Crawling: " << current << std::endl;
-        result.push_back(current);
-        pageCount++;
+public:
+    /**
+     * @param fetcher Page source shared by all workers
+     * @param config Worker count, page budget and politeness settings
+     */
+    ConcurrentCrawler(PageFetcher &fetcher, const CrawlerConfig &config)
+        : fetcher(fetcher), config(config), seen(config.expectedUrls, 10, config.exactSeenTest) {}
 
-        // Get links from the page
-        if (webGraph.find(current) != webGraph.end())
+    /**
+     * @brief Crawl from the seed URLs until the frontier is empty or maxPages is reached
+     *
+     * A crawler object runs one crawl; the frontier and seen set are not reset.
+     *
+     * @param seeds Start URLs
+     * @return std::vector<std::string> URLs in the order their fetches completed
+     */
+    std::vector<std::string> crawl(const std::vector<std::string> &seeds)
+    {
+        auto start = Clock::now();
         {
-            for (const std::string &link : webGraph[current])
+            std::lock_guard<std::mutex> guard(frontierLock);
+            for (const std::string &seed : seeds)
             {
-                if (visited.find(link) == visited.end())
+                if (seen.insertIfNew(seed))
                 {
-                    visited.insert(link);
-                    queue.push(link);
+                    enqueue(seed);
                 }
             }
         }
-    }
 
-    std::cout << "Crawling completed. Visited " << pageCount << " pages." << std::endl;
+        runOnThreads(std::max(1, config.workers), [this](int)
+                     { workerLoop(); });
 
-    return result;
-}
+        stats.hosts = static_cast<int>(hostQueues.size());
+        stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return crawled;
+    }
+
+    const CrawlStats &getStats() const { return stats; }
+    const UrlSeenFilter &getSeenFilter() const { return seen; }
+};
 
 /**
  * @brief Solve a maze using DFS
@@ -2256,11 +4100,15 @@ std::vector<std::vector<int>> generateMazeDFS(int rows, int cols)
  * @param graphSizes Vector of graph sizes to test
  * @param edgeDensities Vector of edge densities to test
  * @param iterations Number of iterations for each test
+ * @param rmatScale If > 0, also report parallel BFS TEPS (traversed edges per
+ *                  second) on an R-MAT graph with 2^rmatScale vertices, after
+ *                  checking each search against the sequential BFS
  */
 void benchmarkTraversalAlgorithms(
     const std::vector<int> &graphSizes,
     const std::vector<double> &edgeDensities,
-    int iterations = 5)
+    int iterations = 5,
+    int rmatScale = 0)
 {
     std::cout << "===== Graph Traversal Algorithm Benchmarks =====" << std::endl;
     std::cout << "Iterations: " << iterations << std::endl
@@ -2270,69 +4118,238 @@ void benchmarkTraversalAlgorithms(
     std::cout << std::left << std::setw(10) << "Vertices"
               << std::setw(10) << "Edges"
               << std::setw(15) << "Density"
+              << std::setw(12) << "Model"
               << std::setw(15) << "BFS (ms)"
               << std::setw(20) << "DFS Recursive (ms)"
               << std::setw(20) << "DFS Iterative (ms)"
               << std::endl;
 
-    std::cout << std::string(90, '-') << std::endl;
+    std::cout << std::string(102, '-') << std::endl;
 
-    // Test different graph sizes and densities
+    // Test different graph sizes and densities, each on a uniform and a skewed graph
     for (int size : graphSizes)
     {
         for (double density : edgeDensities)
         {
-            double bfsTime = 0.0;
-            double dfsRecursiveTime = 0.0;
-            double dfsIterativeTime = 0.0;
-            int totalEdges = 0;
+            for (GraphModel model : {GraphModel::ErdosRenyi, GraphModel::RMAT})
+            {
+                double bfsTime = 0.0;
+                double dfsRecursiveTime = 0.0;
+                double dfsIterativeTime = 0.0;
+                int totalEdges = 0;
 
-            for (int iter = 0; iter < iterations; ++iter)
+                for (int iter = 0; iter < iterations; ++iter)
+                {
+                    // Generate a random graph
+                    auto graph = generateRandomGraph(size, density, false, true, 1.0, 10.0, model);
+                    totalEdges = graph->getEdgeCount();
+
+                    // Pick a random start vertex
+                    std::vector<int> vertices = graph->getVertices();
+                    int startVertex = vertices[0];
+
+                    // Benchmark BFS
+                    auto startBFS = std::chrono::high_resolution_clock::now();
+                    BFS(*graph, startVertex, false);
+                    auto endBFS = std::chrono::high_resolution_clock::now();
+                    std::chrono::duration<double, std::milli> bfsDuration = endBFS - startBFS;
+                    bfsTime += bfsDuration.count();
+
+                    // Benchmark DFS (recursive)
+                    auto startDFSRecursive = std::chrono::high_resolution_clock::now();
+                    DFSRecursive(*graph, startVertex, false);
+                    auto endDFSRecursive = std::chrono::high_resolution_clock::now();
+                    std::chrono::duration<double, std::milli> dfsRecursiveDuration = endDFSRecursive - startDFSRecursive;
+                    dfsRecursiveTime += dfsRecursiveDuration.count();
+
+                    // Benchmark DFS (iterative)
+                    auto startDFSIterative = std::chrono::high_resolution_clock::now();
+                    DFSIterative(*graph, startVertex, false);
+                    auto endDFSIterative = std::chrono::high_resolution_clock::now();
+                    std::chrono::duration<double, std::milli> dfsIterativeDuration = endDFSIterative - startDFSIterative;
+                    dfsIterativeTime += dfsIterativeDuration.count();
+                }
+
+                // Calculate averages
+                bfsTime /= iterations;
+                dfsRecursiveTime /= iterations;
+                dfsIterativeTime /= iterations;
+
+                // Print results
+                std::cout << std::left << std::setw(10) << size
+                          << std::setw(10) << totalEdges
+                          << std::setw(15) << std::fixed << std::setprecision(2) << density
+                          << std::setw(12) << (model == GraphModel::RMAT ? "R-MAT" : "Uniform")
+                          << std::setw(15) << std::fixed << std::setprecision(2) << bfsTime
+                          << std::setw(20) << std::fixed << std::setprecision(2) << dfsRecursiveTime
+                          << std::setw(20) << std::fixed << std::setprecision(2) << dfsIterativeTime
+                          << std::endl;
+            }
+        }
+    }
+
+    std::cout << std::endl;
+
+    if (rmatScale <= 0)
+    {
+        return;
+    }
+
+    // Parallel BFS throughput on a social-network-like R-MAT graph
+    const int edgeFactor = 16;
+    int numVertices = 1 << rmatScale;
+    long long numEdges = static_cast<long long>(edgeFactor) * numVertices;
+
+    std::cout << "===== Direction-Optimizing Parallel BFS (R-MAT) =====" << std::endl;
+    CSRGraph rmatGraph(numVertices, generateRMATEdgeList(numVertices, numEdges), false, true);
+    std::cout << "Scale: " << rmatScale << ", Vertices: " << numVertices
+              << ", Edges: " << rmatGraph.getEdgeCount()
+              << ", Searches: " << iterations << std::endl
+              << std::endl;
+
+    // Graph500-style sources: random vertices with at least one edge
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> vertexDist(0, numVertices - 1);
+    std::vector<int> sources;
+    while (static_cast<int>(sources.size()) < iterations)
+    {
+        int v = vertexDist(gen);
+        if (!rmatGraph.neighbors(v).empty())
+        {
+            sources.push_back(v);
+        }
+    }
+
+    std::cout << std::left << std::setw(25) << "Algorithm"
+              << std::setw(10) << "Threads"
+              << std::setw(15) << "Time (ms)"
+              << std::setw(12) << "MTEPS"
+              << std::setw(12) << "Speedup"
+              << std::setw(18) << "Levels (BU)"
+              << std::setw(15) << "Same Result"
+              << std::endl;
+
+    std::cout << std::string(107, '-') << std::endl;
+
+    // Baseline: sequential top-down BFS on the same CSR graph
+    double sequentialTime = 0.0;
+    long long sequentialEdges = 0;
+    std::vector<std::vector<int>> referenceLevels(sources.size());
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<int> order = BFS(rmatGraph, sources[i], false);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> duration = end - start;
+        sequentialTime += duration.count();
+
+        long long degreeSum = 0;
+        for (int v : order)
+        {
+            degreeSum += static_cast<long long>(rmatGraph.neighbors(v).size());
+        }
+        sequentialEdges += degreeSum / 2;
+
+        // Levels of the sequential search (untimed). BFS order is sorted by level, so the
+        // lowest-level neighbor placed before a vertex is one level above it.
+        std::vector<int> &level = referenceLevels[i];
+        level.assign(numVertices, -1);
+        level[rmatGraph.indexOf(order[0])] = 0;
+        for (size_t k = 1; k < order.size(); k++)
+        {
+            int v = rmatGraph.indexOf(order[k]);
+            for (CSRGraph::Neighbor edge : rmatGraph.neighbors(v))
             {
-                // Generate a random graph
-                auto graph = generateRandomGraph(size, density);
-                totalEdges = graph->getEdgeCount();
+                int above = level[edge.target];
+                if (above >= 0 && (level[v] < 0 || above + 1 < level[v]))
+                {
+                    level[v] = above + 1;
+                }
+            }
+        }
+    }
+    sequentialTime /= iterations;
+
+    // A parallel search matches the sequential one if it reaches the same vertices and
+    // every tree edge is a graph edge going down exactly one sequential level
+    auto sameAsSequential = [&](const std::vector<int> &parent, const std::vector<int> &level)
+    {
+        for (int v = 0; v < numVertices; v++)
+        {
+            if ((parent[v] < 0) != (level[v] < 0))
+            {
+                return false;
+            }
+            if (level[v] <= 0)
+            {
+                if (level[v] == 0 && parent[v] != v)
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            if (level[parent[v]] != level[v] - 1)
+            {
+                return false;
+            }
+            bool isEdge = false;
+            for (CSRGraph::Neighbor edge : rmatGraph.neighbors(v))
+            {
+                isEdge = isEdge || edge.target == parent[v];
+            }
+            if (!isEdge)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
 
-                // Pick a random start vertex
-                std::vector<int> vertices = graph->getVertices();
-                int startVertex = vertices[0];
-
-                // Benchmark BFS
-                auto startBFS = std::chrono::high_resolution_clock::now();
-                BFS(*graph, startVertex, false);
-                auto endBFS = std::chrono::high_resolution_clock::now();
-                std::chrono::duration<double, std::milli> bfsDuration = endBFS - startBFS;
-                bfsTime += bfsDuration.count();
-
-                // Benchmark DFS (recursive)
-                auto startDFSRecursive = std::chrono::high_resolution_clock::now();
-                DFSRecursive(*graph, startVertex, false);
-                auto endDFSRecursive = std::chrono::high_resolution_clock::now();
-                std::chrono::duration<double, std::milli> dfsRecursiveDuration = endDFSRecursive - startDFSRecursive;
-                dfsRecursiveTime += dfsRecursiveDuration.count();
-
-                // Benchmark DFS (iterative)
-                auto startDFSIterative = std::chrono::high_resolution_clock::now();
-                DFSIterative(*graph, startVertex, false);
-                auto endDFSIterative = std::chrono::high_resolution_clock::now();
-                std::chrono::duration<double, std::milli> dfsIterativeDuration = endDFSIterative - startDFSIterative;
-                dfsIterativeTime += dfsIterativeDuration.count();
-            }
-
-            // Calculate averages
-            bfsTime /= iterations;
-            dfsRecursiveTime /= iterations;
-            dfsIterativeTime /= iterations;
+    std::cout << std::left << std::setw(25) << "Sequential BFS (CSR)"
+              << std::setw(10) << 1
+              << std::setw(15) << std::fixed << std::setprecision(2) << sequentialTime
+              << std::setw(12) << std::fixed << std::setprecision(1) << sequentialEdges / (sequentialTime * 1000.0 * iterations)
+              << std::setw(12) << std::fixed << std::setprecision(2) << 1.0
+              << std::setw(18) << "-"
+              << std::setw(15) << "-"
+              << std::endl;
 
-            // Print results
-            std::cout << std::left << std::setw(10) << size
-                      << std::setw(10) << totalEdges
-                      << std::setw(15) << std::fixed << std::setprecision(2) << density
-                      << std::setw(15) << std::fixed << std::setprecision(2) << bfsTime
-                      << std::setw(20) << std::fixed << std::setprecision(2) << dfsRecursiveTime
-                      << std::setw(20) << std::fixed << std::setprecision(2) << dfsIterativeTime
-                      << std::endl;
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (int threads : threadCounts)
+    {
+        double parallelTime = 0.0;
+        long long parallelEdges = 0;
+        bool sameResult = true;
+        ParallelBFSStats stats;
+
+        for (size_t i = 0; i < sources.size(); i++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<int> parent = parallelBFS(rmatGraph, sources[i], threads, &stats);
+            auto end = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double, std::milli> duration = end - start;
+            parallelTime += duration.count();
+            parallelEdges += stats.edgesTraversed;
+            sameResult = sameResult && sameAsSequential(parent, referenceLevels[i]);
         }
+        parallelTime /= iterations;
+
+        std::cout << std::left << std::setw(25) << "Direction-Optimizing BFS"
+                  << std::setw(10) << threads
+                  << std::setw(15) << std::fixed << std::setprecision(2) << parallelTime
+                  << std::setw(12) << std::fixed << std::setprecision(1) << parallelEdges / (parallelTime * 1000.0 * iterations)
+                  << std::setw(12) << std::fixed << std::setprecision(2) << (parallelTime > 0 ? sequentialTime / parallelTime : 0.0)
+                  << std::setw(18) << (std::to_string(stats.levels) + " (" + std::to_string(stats.bottomUpLevels) + ")")
+                  << std::setw(15) << (sameResult ? "Yes" : "No")
+                  << std::endl;
     }
 
     std::cout << std::endl;
@@ -2517,6 +4534,335 @@ void benchmarkConnectedComponents(
     std::cout << std::endl;
 }
 
+/**
+ * @brief Benchmark BFS and iterative DFS on AdjacencyListGraph vs CSRGraph
+ *
+ * @param numVertices Number of vertices
+ * @param numEdges Number of edges (e.g. 10M)
+ * @param iterations Number of iterations for each traversal
+ */
+void benchmarkCSRGraph(int numVertices, long long numEdges, int iterations = 1)
+{
+    std::cout << "===== CSR Graph vs Adjacency List Benchmarks =====" << std::endl;
+    std::cout << "Vertices: " << numVertices << ", Edges: " << numEdges
+              << ", Iterations: " << iterations << std::endl
+              << std::endl;
+
+    auto edges = generateRandomEdgeList(numVertices, numEdges);
+
+    // Build both representations from the same edges
+    auto startBuildList = std::chrono::high_resolution_clock::now();
+    AdjacencyListGraph listGraph(false, true);
+    for (int v = 0; v < numVertices; v++)
+    {
+        listGraph.addVertex(v);
+    }
+    for (const auto &[u, v, w] : edges)
+    {
+        listGraph.addEdge(u, v, w);
+    }
+    auto endBuildList = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> buildListTime = endBuildList - startBuildList;
+
+    auto startConvert = std::chrono::high_resolution_clock::now();
+    CSRGraph convertedGraph(listGraph);
+    auto endConvert = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> convertTime = endConvert - startConvert;
+
+    auto startBuildCSR = std::chrono::high_resolution_clock::now();
+    CSRGraph csrGraph(numVertices, edges, false, true);
+    auto endBuildCSR = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> buildCSRTime = endBuildCSR - startBuildCSR;
+
+    std::cout << std::left << std::setw(40) << "Build adjacency list (ms)"
+              << std::fixed << std::setprecision(2) << buildListTime.count() << std::endl;
+    std::cout << std::left << std::setw(40) << "Convert adjacency list -> CSR (ms)"
+              << std::fixed << std::setprecision(2) << convertTime.count() << std::endl;
+    std::cout << std::left << std::setw(40) << "Build CSR from edge list (ms)"
+              << std::fixed << std::setprecision(2) << buildCSRTime.count() << std::endl
+              << std::endl;
+
+    // Print header
+    std::cout << std::left << std::setw(20) << "Algorithm"
+              << std::setw(20) << "Adj. List (ms)"
+              << std::setw(15) << "CSR (ms)"
+              << std::setw(15) << "Speedup"
+              << std::setw(15) << "Same Order"
+              << std::endl;
+
+    std::cout << std::string(85, '-') << std::endl;
+
+    int startVertex = 0;
+
+    auto runComparison = [&](const std::string &name,
+                             const std::function<std::vector<int>()> &listRun,
+                             const std::function<std::vector<int>()> &csrRun)
+    {
+        double listTime = 0.0;
+        double csrTime = 0.0;
+        bool sameOrder = true;
+
+        for (int iter = 0; iter < iterations; ++iter)
+        {
+            auto startList = std::chrono::high_resolution_clock::now();
+            std::vector<int> listResult = listRun();
+            auto endList = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double, std::milli> listDuration = endList - startList;
+            listTime += listDuration.count();
+
+            auto startCSR = std::chrono::high_resolution_clock::now();
+            std::vector<int> csrResult = csrRun();
+            auto endCSR = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double, std::milli> csrDuration = endCSR - startCSR;
+            csrTime += csrDuration.count();
+
+            sameOrder = sameOrder && listResult == csrResult;
+        }
+
+        listTime /= iterations;
+        csrTime /= iterations;
+
+        std::cout << std::left << std::setw(20) << name
+                  << std::setw(20) << std::fixed << std::setprecision(2) << listTime
+                  << std::setw(15) << std::fixed << std::setprecision(2) << csrTime
+                  << std::setw(15) << std::fixed << std::setprecision(2) << (csrTime > 0 ? listTime / csrTime : 0.0)
+                  << std::setw(15) << (sameOrder ? "Yes" : "No")
+                  << std::endl;
+    };
+
+    // The converted graph keeps the adjacency list's neighbor order, so results must match exactly
+    runComparison("BFS", [&]()
+                  { return BFS(listGraph, startVertex, false); }, [&]()
+                  { return BFS(convertedGraph, startVertex, false); });
+    runComparison("DFS Iterative", [&]()
+                  { return DFSIterative(listGraph, startVertex, false); }, [&]()
+                  { return DFSIterative(convertedGraph, startVertex, false); });
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Benchmark connected components on a large random edge list
+ *
+ * Compares a sequential union-find (union by rank, path compression) with the
+ * concurrent union-find on one thread and on numThreads threads, and checks that
+ * all three produce the same partition.
+ *
+ * @param numVertices Number of vertices
+ * @param numEdges Number of edges (e.g. 100M; duplicates are kept)
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ */
+void benchmarkParallelConnectedComponents(int numVertices, long long numEdges, int numThreads = 0)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::cout << "===== Parallel Connected Components Benchmark =====" << std::endl;
+    std::cout << "Vertices: " << numVertices << ", Edges: " << numEdges
+              << ", Threads: " << numThreads << std::endl
+              << std::endl;
+
+    // Plain (u, v) pairs; a 100M-edge list takes 800 MB
+    std::vector<std::pair<int, int>> edges(numEdges);
+    std::mt19937_64 gen(30);
+    std::uniform_int_distribution<int> vertexDist(0, numVertices - 1);
+    for (auto &edge : edges)
+    {
+        edge = {vertexDist(gen), vertexDist(gen)};
+    }
+
+    std::cout << std::left << std::setw(35) << "Algorithm"
+              << std::setw(15) << "Time (ms)"
+              << std::setw(15) << "Components"
+              << std::setw(15) << "Same Result"
+              << std::endl;
+
+    std::cout << std::string(80, '-') << std::endl;
+
+    // Sequential baseline: union by rank with iterative path compression
+    auto startSeq = std::chrono::high_resolution_clock::now();
+    std::vector<int> parent(numVertices);
+    std::vector<unsigned char> rank(numVertices, 0);
+    for (int v = 0; v < numVertices; v++)
+    {
+        parent[v] = v;
+    }
+    auto findRoot = [&parent](int x)
+    {
+        int root = x;
+        while (parent[root] != root)
+        {
+            root = parent[root];
+        }
+        while (parent[x] != root)
+        {
+            int next = parent[x];
+            parent[x] = root;
+            x = next;
+        }
+        return root;
+    };
+    for (const auto &[u, v] : edges)
+    {
+        int ru = findRoot(u);
+        int rv = findRoot(v);
+        if (ru == rv)
+        {
+            continue;
+        }
+        if (rank[ru] < rank[rv])
+        {
+            std::swap(ru, rv);
+        }
+        parent[rv] = ru;
+        if (rank[ru] == rank[rv])
+        {
+            rank[ru]++;
+        }
+    }
+    std::vector<int> reference(numVertices);
+    int referenceComponents = 0;
+    for (int v = 0; v < numVertices; v++)
+    {
+        reference[v] = findRoot(v);
+        referenceComponents += reference[v] == v;
+    }
+    auto endSeq = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> seqTime = endSeq - startSeq;
+
+    std::cout << std::left << std::setw(35) << "Sequential union-find"
+              << std::setw(15) << std::fixed << std::setprecision(2) << seqTime.count()
+              << std::setw(15) << referenceComponents
+              << std::setw(15) << "-"
+              << std::endl;
+
+    // Two labelings describe the same partition if the label mapping is one-to-one
+    auto samePartition = [&](const std::vector<int> &labels)
+    {
+        std::vector<int> forward(numVertices, -1), backward(numVertices, -1);
+        for (int v = 0; v < numVertices; v++)
+        {
+            int a = reference[v], b = labels[v];
+            if ((forward[a] != -1 && forward[a] != b) || (backward[b] != -1 && backward[b] != a))
+            {
+                return false;
+            }
+            forward[a] = b;
+            backward[b] = a;
+        }
+        return true;
+    };
+
+    std::vector<int> threadCounts = {1};
+    if (numThreads > 1)
+    {
+        threadCounts.push_back(numThreads);
+    }
+
+    for (int threads : threadCounts)
+    {
+        int components = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<int> labels = parallelConnectedComponents(numVertices, edges, threads, &components);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> duration = end - start;
+
+        std::cout << std::left << std::setw(35) << ("Concurrent union-find (" + std::to_string(threads) + " thr)")
+                  << std::setw(15) << std::fixed << std::setprecision(2) << duration.count()
+                  << std::setw(15) << components
+                  << std::setw(15) << (components == referenceComponents && samePartition(labels) ? "Yes" : "No")
+                  << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Benchmark the concurrent crawler against fetch latency and worker count
+ *
+ * Crawls a synthetic web (hosts x pagesPerHost pages, 10 links per page) with a
+ * simulated fetcher. With blocking fetches, throughput should grow with the
+ * number of workers until the frontier or the CPU becomes the bottleneck.
+ *
+ * @param latenciesMicros Simulated fetch latencies to test (microseconds)
+ * @param workerCounts Worker counts to test
+ * @param numHosts Number of hosts in the synthetic web
+ * @param pagesPerHost Pages per host
+ */
+void benchmarkConcurrentCrawler(const std::vector<int> &latenciesMicros, const std::vector<int> &workerCounts,
+                                int numHosts = 1000, int pagesPerHost = 1000)
+{
+    std::cout << "===== Concurrent Web Crawler Benchmark =====" << std::endl;
+    std::cout << "Synthetic web: " << numHosts << " hosts x " << pagesPerHost << " pages, 10 links per page"
+              << std::endl
+              << std::endl;
+
+    std::cout << std::left << std::setw(15) << "Latency (us)"
+              << std::setw(10) << "Workers"
+              << std::setw(10) << "Pages"
+              << std::setw(15) << "Time (ms)"
+              << std::setw(15) << "Pages/sec"
+              << std::setw(15) << "Ideal/sec"
+              << std::endl;
+    std::cout << std::string(80, '-') << std::endl;
+
+    auto web = SimulatedFetcher::syntheticWeb(numHosts, pagesPerHost, 10);
+    std::vector<std::string> seeds;
+    for (int h = 0; h < numHosts; h += std::max(1, numHosts / 16))
+    {
+        seeds.push_back("http://h" + std::to_string(h) + ".test/p0");
+    }
+
+    for (int latency : latenciesMicros)
+    {
+        for (int workers : workerCounts)
+        {
+            // Enough pages to last about 0.25 s at the ideal rate
+            double idealRate = latency > 0 ? workers * 1e6 / latency : 1e9;
+            CrawlerConfig config;
+            config.workers = workers;
+            config.maxPages = static_cast<int>(std::min(20000.0, std::max(100.0, idealRate / 4)));
+
+            SimulatedFetcher fetcher(web, std::chrono::microseconds(latency), std::chrono::microseconds(latency / 4));
+            ConcurrentCrawler crawler(fetcher, config);
+            crawler.crawl(seeds);
+            const CrawlStats &stats = crawler.getStats();
+
+            std::cout << std::left << std::setw(15) << latency
+                      << std::setw(10) << workers
+                      << std::setw(10) << stats.pagesFetched
+                      << std::setw(15) << std::fixed << std::setprecision(2) << stats.seconds * 1000.0
+                      << std::setw(15) << std::setprecision(0) << stats.pagesPerSecond()
+                      << std::setw(15) << (latency > 0 ? std::to_string(static_cast<long long>(idealRate)) : "-")
+                      << std::endl;
+        }
+    }
+
+    // URL-seen filter on its own: a large crawl with no latency
+    CrawlerConfig config;
+    config.workers = 4;
+    config.maxPages = 200000;
+    config.expectedUrls = 2000000;
+    SimulatedFetcher fetcher(web, std::chrono::microseconds(0));
+    ConcurrentCrawler crawler(fetcher, config);
+    crawler.crawl(seeds);
+    const CrawlStats &stats = crawler.getStats();
+    const UrlSeenFilter &seen = crawler.getSeenFilter();
+    long long checks = stats.linksSeen + static_cast<long long>(seeds.size());
+
+    std::cout << std::endl
+              << "Zero-latency crawl of " << stats.pagesFetched << " pages: " << std::setprecision(0)
+              << stats.pagesPerSecond() << " pages/sec, " << stats.linksSeen << " links checked, "
+              << stats.newUrls << " new" << std::endl;
+    std::cout << "  Bloom filter said \"definitely new\" for " << seen.bloomNegativeCount() << " of " << checks
+              << " checks; " << seen.bloomFalsePositiveCount()
+              << " new URLs would have been lost without the fingerprint set" << std::endl
+              << std::endl;
+    std::cout << std::setprecision(6) << std::defaultfloat;
+}
+
 /****************************************************************************************
  * DEMONSTRATION FUNCTIONS
  ****************************************************************************************/
@@ -3166,13 +5512,35 @@ void demoWebCrawler()
     {
         std::cout << i + 1 << ". " << crawledPages[i] << std::endl;
     }
+
+    // Same site with 4 workers, 2 ms simulated latency and 5 ms between requests to one host
+    std::cout << "\nConcurrent crawl (4 workers, 2 ms latency, 5 ms politeness delay):" << std::endl;
+    SimulatedFetcher fetcher(SimulatedFetcher::fromMap(sampleWebGraph()), std::chrono::milliseconds(2));
+    CrawlerConfig config;
+    config.workers = 4;
+    config.maxPages = 20;
+    config.politenessDelay = std::chrono::milliseconds(5);
+    ConcurrentCrawler crawler(fetcher, config);
+    std::vector<std::string> pages = crawler.crawl({startUrl});
+    for (size_t i = 0; i < pages.size(); i++)
+    {
+        std::cout << i + 1 << ". " << pages[i] << std::endl;
+    }
+    const CrawlStats &stats = crawler.getStats();
+    std::cout << "Fetched " << stats.pagesFetched << " pages from " << stats.hosts << " hosts in "
+              << stats.seconds * 1000.0 << " ms" << std::endl;
 }
 
 /**
  * @brief Main function
+ *
+ * Pass --large to also run the benchmarks at full scale (millions of vertices,
+ * minutes and gigabytes); by default they run at demo size.
  */
-int main()
+int main(int argc, char *argv[])
 {
+    bool runLarge = argc > 1 && std::string(argv[1]) == "--large";
+
     std::cout << "======================================================" << std::endl;
     std::cout << "=== DAY 30: GRAPH TRAVERSAL ALGORITHMS             ===" << std::endl;
     std::cout << "=== Part of #DSAin45 Course                        ===" << std::endl;
@@ -3206,9 +5574,19 @@ int main()
     // Run benchmarks (optional - can be commented out for faster execution)
     std::cout << "Running benchmarks (this may take a moment)..." << std::endl;
 
-    benchmarkTraversalAlgorithms({100, 500, 1000}, {0.01, 0.1}, 2);
+    benchmarkTraversalAlgorithms({100, 500, 1000}, {0.01, 0.1}, 2, runLarge ? 20 : 16);
     benchmarkPathFinding({100, 500, 1000}, 2);
     benchmarkConnectedComponents({100, 500}, {2, 5}, 2);
+    benchmarkCSRGraph(runLarge ? 1000000 : 100000, runLarge ? 10000000 : 1000000, 1);
+    if (runLarge)
+    {
+        benchmarkParallelConnectedComponents(10000000, 100000000);
+    }
+    else
+    {
+        benchmarkParallelConnectedComponents(100000, 1000000);
+    }
+    benchmarkConcurrentCrawler({1000, 10000}, {1, 4, 16, 64});
 
     std::cout << "======================================================" << std::endl;
     std::cout << "=== End of DAY 30 Demonstrations                   ===" << std::endl;
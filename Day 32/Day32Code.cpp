@@ -1,6 +1,7 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <stack>
 #include <unordered_set>
 #include <unordered_map>
@@ -17,6 +18,9 @@
 #include <fstream>
 #include <memory>
 #include <cmath>
+#include <atomic>
+#include <thread>
+#include <numeric>
 
 /**
  * @brief Comprehensive Minimum Spanning Tree Implementation for #DSAin45 Day 32
@@ -26,6 +30,9 @@
  * - Kruskal's Algorithm
  * - Borůvka's Algorithm
  * - Reverse-Delete Algorithm
+ * - Filter-Kruskal and parallel Borůvka with a concurrent union-find
+ * - k-nearest-neighbor candidate edges for large Euclidean instances
+ * - 2-opt / Or-opt TSP local search over nearest-neighbor candidate lists
  * - Various optimizations and applications
  * - Performance benchmarks
  *
@@ -628,12 +635,15 @@ public:
      */
     int findSet(int v)
     {
-        if (parent[v] != v)
+        // Path splitting: point every node on the path to its grandparent. Unlike
+        // recursive path compression this needs no stack, however deep the tree is.
+        while (parent[v] != v)
         {
-            // Path compression: make all nodes on the path point directly to the root
-            parent[v] = findSet(parent[v]);
+            int next = parent[v];
+            parent[v] = parent[next];
+            v = next;
         }
-        return parent[v];
+        return v;
     }
 
     /**
@@ -679,6 +689,118 @@ public:
     }
 };
 
+/**
+ * @brief Thread-safe disjoint-set over dense indices 0..n-1
+ *
+ * Parent links are atomics. findSet() uses path splitting and unionSets() links the
+ * root with the larger index below the root with the smaller index using
+ * compare-and-swap, so concurrent unions never create a cycle and no locks are needed.
+ */
+class ConcurrentDisjointSet
+{
+private:
+    mutable std::vector<std::atomic<int>> parent; // Parent index of each element
+
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param size Number of elements
+     */
+    explicit ConcurrentDisjointSet(int size) : parent(size)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Find the representative of the set containing v
+     *
+     * @param v Element index
+     * @return Representative index
+     */
+    int findSet(int v) const
+    {
+        while (true)
+        {
+            int p = parent[v].load(std::memory_order_acquire);
+            if (p == v)
+            {
+                return v;
+            }
+
+            int grandparent = parent[p].load(std::memory_order_acquire);
+            if (grandparent != p)
+            {
+                // Path splitting; v is not a root, so its parent only ever moves to another
+                // ancestor and racing stores cannot break the tree
+                parent[v].store(grandparent, std::memory_order_release);
+            }
+            v = p;
+        }
+    }
+
+    /**
+     * @brief Merge the sets containing u and v
+     *
+     * @param u First element
+     * @param v Second element
+     * @return True if two different sets were merged, false if u and v were already connected
+     */
+    bool unionSets(int u, int v)
+    {
+        while (true)
+        {
+            u = findSet(u);
+            v = findSet(v);
+            if (u == v)
+            {
+                return false;
+            }
+
+            if (u < v)
+            {
+                std::swap(u, v);
+            }
+
+            // u is only linked if it is still a root
+            int expected = u;
+            if (parent[u].compare_exchange_strong(expected, v, std::memory_order_acq_rel))
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Check if two elements are in the same set
+     *
+     * @param u First element
+     * @param v Second element
+     * @return True if u and v are in the same set, false otherwise
+     */
+    bool sameSet(int u, int v) const
+    {
+        while (true)
+        {
+            u = findSet(u);
+            v = findSet(v);
+            if (u == v)
+            {
+                return true;
+            }
+
+            // If u is still a root, the two sets were distinct at this point
+            if (parent[u].load(std::memory_order_acquire) == u)
+            {
+                return false;
+            }
+        }
+    }
+};
+
 /****************************************************************************************
  * MINIMUM SPANNING TREE ALGORITHMS
  ****************************************************************************************/
@@ -1058,128 +1180,1098 @@ bool isConnected(const IGraph &graph)
     std::vector<int> vertices = graph.getVertices();
     if (vertices.empty())
     {
-        return true;
+        return true;
+    }
+
+    std::unordered_set<int> visited;
+    std::queue<int> queue;
+
+    // Start BFS from the first vertex
+    int start = vertices[0];
+    visited.insert(start);
+    queue.push(start);
+
+    while (!queue.empty())
+    {
+        int current = queue.front();
+        queue.pop();
+
+        for (int neighbor : graph.getNeighbors(current))
+        {
+            if (visited.find(neighbor) == visited.end())
+            {
+                visited.insert(neighbor);
+                queue.push(neighbor);
+            }
+        }
+    }
+
+    // Check if all vertices are visited
+    return visited.size() == vertices.size();
+}
+
+/**
+ * @brief Implementation of the Reverse-Delete algorithm for finding the MST
+ *
+ * The Reverse-Delete algorithm starts with all edges and removes them in order of
+ * decreasing weight, as long as removing the edge doesn't disconnect the graph.
+ *
+ * Time Complexity: O(E log E) for sorting, O(E(V+E)) for connectivity checks
+ * Space Complexity: O(V + E)
+ *
+ * @param graph The graph to find the MST for
+ * @param totalWeight Output parameter for the total weight of the MST
+ * @return Vector of (source, destination) pairs representing MST edges
+ */
+std::vector<std::pair<int, int>> reverseDeleteMST(const IGraph &graph, double &totalWeight)
+{
+    std::vector<int> vertices = graph.getVertices();
+    int n = vertices.size();
+
+    // Get all edges from the graph
+    std::vector<std::tuple<double, int, int>> edges;
+
+    for (int u : vertices)
+    {
+        for (int v : graph.getNeighbors(u))
+        {
+            // For undirected graphs, add each edge only once
+            if (!graph.isDirected() && u < v)
+            {
+                double weight = graph.getEdgeWeight(u, v);
+                edges.push_back({weight, u, v});
+            }
+            else if (graph.isDirected())
+            {
+                double weight = graph.getEdgeWeight(u, v);
+                edges.push_back({weight, u, v});
+            }
+        }
+    }
+
+    // Sort edges by weight in descending order
+    std::sort(edges.begin(), edges.end(), std::greater<std::tuple<double, int, int>>());
+
+    // Create a copy of the graph
+    auto mstGraph = std::make_unique<AdjacencyListGraph>(false, true);
+
+    // Add all vertices
+    for (int v : vertices)
+    {
+        mstGraph->addVertex(v);
+    }
+
+    // Add all edges
+    for (const auto &[weight, u, v] : edges)
+    {
+        mstGraph->addEdge(u, v, weight);
+    }
+
+    // Process edges in order of decreasing weight
+    for (const auto &[weight, u, v] : edges)
+    {
+        // Temporarily remove the edge
+        mstGraph->removeEdge(u, v);
+
+        // Check if the graph is still connected
+        bool connected = isConnected(*mstGraph);
+
+        // If removing the edge disconnects the graph, add it back
+        if (!connected)
+        {
+            mstGraph->addEdge(u, v, weight);
+        }
+    }
+
+    // Extract the MST edges
+    std::vector<std::pair<int, int>> mstEdges;
+    totalWeight = 0.0;
+
+    for (int u : vertices)
+    {
+        for (int v : mstGraph->getNeighbors(u))
+        {
+            // For undirected graphs, add each edge only once
+            if (u < v)
+            {
+                double weight = mstGraph->getEdgeWeight(u, v);
+                mstEdges.push_back({u, v});
+                totalWeight += weight;
+            }
+        }
+    }
+
+    return mstEdges;
+}
+
+/****************************************************************************************
+ * SCALABLE MST ALGORITHMS (EDGE LISTS OVER DENSE INDICES)
+ ****************************************************************************************/
+
+/**
+ * @brief Undirected weighted edge between dense vertex indices
+ */
+struct WeightedEdge
+{
+    double weight;
+    int u;
+    int v;
+};
+
+/**
+ * @brief Run body(threadId) on numThreads threads (the caller acts as thread 0)
+ */
+void runOnThreads(int numThreads, const std::function<void(int)> &body)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads - 1);
+    for (int t = 1; t < numThreads; t++)
+    {
+        workers.emplace_back(body, t);
+    }
+    body(0);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Sort a block of edges and add those that join two components to the forest
+ */
+void kruskalOnEdges(std::vector<WeightedEdge>::iterator first,
+                    std::vector<WeightedEdge>::iterator last,
+                    ConcurrentDisjointSet &ds,
+                    std::vector<WeightedEdge> &forest,
+                    size_t maxEdges)
+{
+    // Ties are broken by endpoints, like sorting (weight, u, v) tuples in kruskalMST
+    std::sort(first, last, [](const WeightedEdge &a, const WeightedEdge &b)
+              { return std::tie(a.weight, a.u, a.v) < std::tie(b.weight, b.u, b.v); });
+
+    for (auto it = first; it != last && forest.size() < maxEdges; ++it)
+    {
+        if (ds.unionSets(it->u, it->v))
+        {
+            forest.push_back(*it);
+        }
+    }
+}
+
+/**
+ * @brief Kruskal's algorithm on an edge list (sorts every edge up front)
+ *
+ * @param numVertices Number of vertices (indices 0..numVertices-1)
+ * @param edges Candidate edges
+ * @param totalWeight Output parameter for the total weight of the forest
+ * @return Edges of a minimum spanning forest
+ */
+std::vector<WeightedEdge> kruskalForest(int numVertices, std::vector<WeightedEdge> edges, double &totalWeight)
+{
+    std::vector<WeightedEdge> forest;
+    ConcurrentDisjointSet ds(numVertices);
+    kruskalOnEdges(edges.begin(), edges.end(), ds, forest, numVertices > 0 ? numVertices - 1 : 0);
+
+    totalWeight = 0.0;
+    for (const auto &edge : forest)
+    {
+        totalWeight += edge.weight;
+    }
+    return forest;
+}
+
+// Blocks at or below this size are simply sorted
+const size_t FILTER_KRUSKAL_BASE_SIZE = 2048;
+
+/**
+ * @brief Recursive step of filter-Kruskal on edges [first, last)
+ */
+void filterKruskalRecursive(std::vector<WeightedEdge>::iterator first,
+                            std::vector<WeightedEdge>::iterator last,
+                            ConcurrentDisjointSet &ds,
+                            std::vector<WeightedEdge> &forest,
+                            size_t maxEdges)
+{
+    if (forest.size() >= maxEdges || first == last)
+    {
+        return;
+    }
+
+    size_t size = last - first;
+    if (size <= FILTER_KRUSKAL_BASE_SIZE)
+    {
+        kruskalOnEdges(first, last, ds, forest, maxEdges);
+        return;
+    }
+
+    // Median of three spread-out samples as pivot
+    double a = first[size / 4].weight;
+    double b = first[size / 2].weight;
+    double c = first[3 * size / 4].weight;
+    double pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+
+    auto middle = std::partition(first, last, [pivot](const WeightedEdge &edge)
+                                 { return edge.weight <= pivot; });
+    if (middle == last)
+    {
+        // The pivot is the maximum weight, so partitioning made no progress
+        kruskalOnEdges(first, last, ds, forest, maxEdges);
+        return;
+    }
+
+    filterKruskalRecursive(first, middle, ds, forest, maxEdges);
+    if (forest.size() >= maxEdges)
+    {
+        return;
+    }
+
+    // Heavy edges inside a component can never join the forest
+    auto kept = std::remove_if(middle, last, [&ds](const WeightedEdge &edge)
+                               { return ds.sameSet(edge.u, edge.v); });
+    filterKruskalRecursive(middle, kept, ds, forest, maxEdges);
+}
+
+/**
+ * @brief Filter-Kruskal minimum spanning forest
+ *
+ * Like quicksort, the edges are partitioned around a pivot weight. The light half is
+ * processed first; afterwards every heavy edge whose endpoints are already connected is
+ * filtered out before the heavy half is partitioned further. On graphs with many more
+ * edges than vertices most heavy edges are discarded without ever being sorted.
+ *
+ * Time Complexity: O(E + V log V log(E/V)) expected on random weights, O(E log E) worst case
+ * Space Complexity: O(V + E)
+ *
+ * @param numVertices Number of vertices (indices 0..numVertices-1)
+ * @param edges Candidate edges
+ * @param totalWeight Output parameter for the total weight of the forest
+ * @return Edges of a minimum spanning forest
+ */
+std::vector<WeightedEdge> filterKruskalForest(int numVertices, std::vector<WeightedEdge> edges, double &totalWeight)
+{
+    std::vector<WeightedEdge> forest;
+    ConcurrentDisjointSet ds(numVertices);
+    filterKruskalRecursive(edges.begin(), edges.end(), ds, forest, numVertices > 0 ? numVertices - 1 : 0);
+
+    totalWeight = 0.0;
+    for (const auto &edge : forest)
+    {
+        totalWeight += edge.weight;
+    }
+    return forest;
+}
+
+/**
+ * @brief Parallel Borůvka minimum spanning forest
+ *
+ * Every round, each thread scans a slice of the remaining edges, drops the ones that
+ * already lie inside one component and offers the rest to both endpoint components
+ * with an atomic minimum. Ties are broken by edge index, so the chosen edges always
+ * form a forest. The winning edges are then merged through the concurrent union-find.
+ * The number of components at least halves every round.
+ *
+ * Time Complexity: O(E log V / p + V log V) with p threads
+ * Space Complexity: O(V + E)
+ *
+ * @param numVertices Number of vertices (indices 0..numVertices-1)
+ * @param edges Candidate edges
+ * @param totalWeight Output parameter for the total weight of the forest
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @return Edges of a minimum spanning forest
+ */
+std::vector<WeightedEdge> parallelBoruvkaForest(int numVertices,
+                                                const std::vector<WeightedEdge> &edges,
+                                                double &totalWeight,
+                                                int numThreads = 0)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    ConcurrentDisjointSet ds(numVertices);
+    std::vector<std::atomic<double>> bestWeight(numVertices);
+    std::vector<std::atomic<long long>> best(numVertices);
+
+    // Remaining edges with their endpoints replaced by the roots seen in the last round,
+    // which keeps later finds short
+    struct ActiveEdge
+    {
+        double weight;
+        int u;
+        int v;
+        long long index;
+    };
+    std::vector<ActiveEdge> active(edges.size());
+    for (size_t i = 0; i < edges.size(); i++)
+    {
+        active[i] = {edges[i].weight, edges[i].u, edges[i].v, static_cast<long long>(i)};
+    }
+
+    std::vector<std::vector<ActiveEdge>> localActive(numThreads);
+    std::vector<std::vector<long long>> localChosen(numThreads);
+    std::vector<WeightedEdge> forest;
+
+    auto lowerWeight = [](std::atomic<double> &slot, double weight)
+    {
+        double current = slot.load(std::memory_order_relaxed);
+        while (weight < current && !slot.compare_exchange_weak(current, weight, std::memory_order_relaxed))
+        {
+        }
+    };
+
+    auto lowerIndex = [](std::atomic<long long> &slot, long long e)
+    {
+        long long current = slot.load(std::memory_order_relaxed);
+        while ((current == -1 || e < current) && !slot.compare_exchange_weak(current, e, std::memory_order_relaxed))
+        {
+        }
+    };
+
+    while (!active.empty())
+    {
+        size_t m = active.size();
+
+        // Find the lightest outgoing edge of every component
+        runOnThreads(numThreads, [&](int t)
+                     {
+            size_t vBegin = static_cast<size_t>(numVertices) * t / numThreads;
+            size_t vEnd = static_cast<size_t>(numVertices) * (t + 1) / numThreads;
+            for (size_t v = vBegin; v < vEnd; v++)
+            {
+                bestWeight[v].store(std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+                best[v].store(-1, std::memory_order_relaxed);
+            } });
+
+        runOnThreads(numThreads, [&](int t)
+                     {
+            auto &kept = localActive[t];
+            kept.clear();
+            for (size_t i = m * t / numThreads; i < m * (t + 1) / numThreads; i++)
+            {
+                ActiveEdge edge = active[i];
+                edge.u = ds.findSet(edge.u);
+                edge.v = ds.findSet(edge.v);
+                if (edge.u == edge.v)
+                {
+                    continue;
+                }
+                kept.push_back(edge);
+                lowerWeight(bestWeight[edge.u], edge.weight);
+                lowerWeight(bestWeight[edge.v], edge.weight);
+            } });
+
+        // Among the edges of minimum weight, each component keeps the lowest index
+        runOnThreads(numThreads, [&](int t)
+                     {
+            for (const auto &edge : localActive[t])
+            {
+                if (edge.weight == bestWeight[edge.u].load(std::memory_order_relaxed))
+                {
+                    lowerIndex(best[edge.u], edge.index);
+                }
+                if (edge.weight == bestWeight[edge.v].load(std::memory_order_relaxed))
+                {
+                    lowerIndex(best[edge.v], edge.index);
+                }
+            } });
+
+        // Merge along the chosen edges; an edge chosen by both of its components is added once
+        runOnThreads(numThreads, [&](int t)
+                     {
+            auto &chosen = localChosen[t];
+            chosen.clear();
+            size_t vBegin = static_cast<size_t>(numVertices) * t / numThreads;
+            size_t vEnd = static_cast<size_t>(numVertices) * (t + 1) / numThreads;
+            for (size_t v = vBegin; v < vEnd; v++)
+            {
+                long long e = best[v].load(std::memory_order_relaxed);
+                if (e >= 0 && ds.unionSets(edges[e].u, edges[e].v))
+                {
+                    chosen.push_back(e);
+                }
+            } });
+
+        bool merged = false;
+        active.clear();
+        for (int t = 0; t < numThreads; t++)
+        {
+            for (long long e : localChosen[t])
+            {
+                forest.push_back(edges[e]);
+                merged = true;
+            }
+            active.insert(active.end(), localActive[t].begin(), localActive[t].end());
+        }
+
+        if (!merged)
+        {
+            break;
+        }
+    }
+
+    totalWeight = 0.0;
+    for (const auto &edge : forest)
+    {
+        totalWeight += edge.weight;
+    }
+    return forest;
+}
+
+/**
+ * @brief Convert an undirected IGraph into a dense-index edge list
+ *
+ * @param graph Input graph
+ * @param vertices Output vertex IDs, indexed by dense index
+ * @return Edge list with each undirected edge once
+ */
+std::vector<WeightedEdge> toEdgeList(const IGraph &graph, std::vector<int> &vertices)
+{
+    // Sorted IDs make dense indices, and therefore tie-breaking, follow vertex IDs
+    vertices = graph.getVertices();
+    std::sort(vertices.begin(), vertices.end());
+    std::unordered_map<int, int> indexOf;
+    for (size_t i = 0; i < vertices.size(); i++)
+    {
+        indexOf[vertices[i]] = i;
+    }
+
+    std::vector<WeightedEdge> edges;
+    for (int u : vertices)
+    {
+        for (int v : graph.getNeighbors(u))
+        {
+            if (graph.isDirected() || u < v)
+            {
+                edges.push_back({graph.getEdgeWeight(u, v), indexOf[u], indexOf[v]});
+            }
+        }
+    }
+    return edges;
+}
+
+/**
+ * @brief Map a spanning forest back to vertex IDs, or report that the graph is disconnected
+ */
+std::vector<std::pair<int, int>> toSpanningTree(const std::vector<WeightedEdge> &forest,
+                                                const std::vector<int> &vertices,
+                                                double &totalWeight)
+{
+    std::vector<std::pair<int, int>> mstEdges;
+
+    if (forest.size() + 1 != vertices.size() && !vertices.empty())
+    {
+        // Graph is not connected, no spanning tree exists
+        totalWeight = std::numeric_limits<double>::infinity();
+        return mstEdges;
+    }
+
+    for (const auto &edge : forest)
+    {
+        mstEdges.push_back({vertices[edge.u], vertices[edge.v]});
+    }
+    return mstEdges;
+}
+
+/**
+ * @brief Filter-Kruskal MST on an IGraph
+ *
+ * @param graph The graph to find the MST for
+ * @param totalWeight Output parameter for the total weight of the MST
+ * @return Vector of (source, destination) pairs representing MST edges
+ */
+std::vector<std::pair<int, int>> filterKruskalMST(const IGraph &graph, double &totalWeight)
+{
+    std::vector<int> vertices;
+    auto edges = toEdgeList(graph, vertices);
+    auto forest = filterKruskalForest(vertices.size(), std::move(edges), totalWeight);
+    return toSpanningTree(forest, vertices, totalWeight);
+}
+
+/**
+ * @brief Parallel Borůvka MST on an IGraph
+ *
+ * @param graph The graph to find the MST for
+ * @param totalWeight Output parameter for the total weight of the MST
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @return Vector of (source, destination) pairs representing MST edges
+ */
+std::vector<std::pair<int, int>> parallelBoruvkaMST(const IGraph &graph, double &totalWeight, int numThreads = 0)
+{
+    std::vector<int> vertices;
+    auto edges = toEdgeList(graph, vertices);
+    auto forest = parallelBoruvkaForest(vertices.size(), edges, totalWeight, numThreads);
+    return toSpanningTree(forest, vertices, totalWeight);
+}
+
+/**
+ * @brief The k nearest neighbors of every point
+ *
+ * Points are bucketed into a uniform grid with about two points per cell. Each query
+ * scans rings of cells outward from its own cell and stops once the next ring is
+ * farther away than the current k-th neighbor, so the cost is O(k) expected per point
+ * on evenly spread data instead of the O(n) per point of a complete graph.
+ *
+ * @param points Point coordinates, indexed by dense index
+ * @param k Number of neighbors per point (must be between 1 and n - 1)
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @return neighbors[i * k + j] = j-th nearest neighbor of point i, nearest first
+ */
+std::vector<int> nearestNeighborLists(const std::vector<std::pair<double, double>> &points,
+                                      int k,
+                                      int numThreads = 0)
+{
+    int n = points.size();
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Bounding box and grid dimensions
+    double minX = points[0].first, maxX = minX, minY = points[0].second, maxY = minY;
+    for (const auto &[x, y] : points)
+    {
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+    }
+    double span = std::max({maxX - minX, maxY - minY, 1e-9});
+    double area = std::max((maxX - minX) * (maxY - minY), span * span / n);
+    double cellSize = std::sqrt(2.0 * area / n);
+    int gridWidth = static_cast<int>((maxX - minX) / cellSize) + 1;
+    int gridHeight = static_cast<int>((maxY - minY) / cellSize) + 1;
+
+    auto cellOf = [&](int i)
+    {
+        int cx = std::min(gridWidth - 1, static_cast<int>((points[i].first - minX) / cellSize));
+        int cy = std::min(gridHeight - 1, static_cast<int>((points[i].second - minY) / cellSize));
+        return std::make_pair(cx, cy);
+    };
+
+    // Counting sort of points into cells
+    std::vector<int> cellStart(static_cast<size_t>(gridWidth) * gridHeight + 1, 0);
+    for (int i = 0; i < n; i++)
+    {
+        auto [cx, cy] = cellOf(i);
+        cellStart[static_cast<size_t>(cy) * gridWidth + cx + 1]++;
+    }
+    for (size_t c = 1; c < cellStart.size(); c++)
+    {
+        cellStart[c] += cellStart[c - 1];
+    }
+    std::vector<int> cellPoints(n);
+    std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+    for (int i = 0; i < n; i++)
+    {
+        auto [cx, cy] = cellOf(i);
+        cellPoints[fill[static_cast<size_t>(cy) * gridWidth + cx]++] = i;
+    }
+
+    // Coordinates in cell order, so scanning a cell reads contiguous memory
+    std::vector<double> cellX(n), cellY(n);
+    for (int p = 0; p < n; p++)
+    {
+        cellX[p] = points[cellPoints[p]].first;
+        cellY[p] = points[cellPoints[p]].second;
+    }
+
+    std::vector<int> neighbors(static_cast<size_t>(n) * k);
+    int maxRing = std::max(gridWidth, gridHeight);
+
+    runOnThreads(numThreads, [&](int t)
+                 {
+        std::vector<std::pair<double, int>> heap; // Max-heap of (squared distance, point)
+        heap.reserve(k + 1);
+
+        // Queries run in cell order so consecutive queries touch the same cells
+        for (int position = n * static_cast<long long>(t) / numThreads; position < n * static_cast<long long>(t + 1) / numThreads; position++)
+        {
+            heap.clear();
+            int i = cellPoints[position];
+            double px = cellX[position], py = cellY[position];
+            auto [cx, cy] = cellOf(i);
+
+            auto scanCell = [&](int x, int y)
+            {
+                if (x < 0 || y < 0 || x >= gridWidth || y >= gridHeight)
+                {
+                    return;
+                }
+                size_t cell = static_cast<size_t>(y) * gridWidth + x;
+                for (int p = cellStart[cell]; p < cellStart[cell + 1]; p++)
+                {
+                    if (p == position)
+                    {
+                        continue;
+                    }
+                    double dx = cellX[p] - px, dy = cellY[p] - py;
+                    double d = dx * dx + dy * dy;
+                    if (static_cast<int>(heap.size()) < k)
+                    {
+                        heap.push_back({d, cellPoints[p]});
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                    else if (d < heap.front().first)
+                    {
+                        std::pop_heap(heap.begin(), heap.end());
+                        heap.back() = {d, cellPoints[p]};
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                }
+            };
+
+            for (int ring = 0; ring <= maxRing; ring++)
+            {
+                if (ring == 0)
+                {
+                    scanCell(cx, cy);
+                }
+                else
+                {
+                    for (int x = cx - ring; x <= cx + ring; x++)
+                    {
+                        scanCell(x, cy - ring);
+                        scanCell(x, cy + ring);
+                    }
+                    for (int y = cy - ring + 1; y <= cy + ring - 1; y++)
+                    {
+                        scanCell(cx - ring, y);
+                        scanCell(cx + ring, y);
+                    }
+                }
+
+                // Every unscanned point is at least ring * cellSize away
+                double reach = ring * cellSize;
+                if (static_cast<int>(heap.size()) == k && heap.front().first <= reach * reach)
+                {
+                    break;
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end());
+            for (int j = 0; j < k; j++)
+            {
+                neighbors[static_cast<size_t>(i) * k + j] = heap[j].second;
+            }
+        } });
+
+    return neighbors;
+}
+
+/**
+ * @brief Candidate edges from every point to its k nearest neighbors
+ *
+ * The Euclidean MST is almost always contained in the k-NN graph for k around 8, but
+ * this is not guaranteed; callers should check that the resulting forest spans.
+ *
+ * @param points Point coordinates, indexed by dense index
+ * @param k Number of neighbors per point
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @return Undirected edges weighted by Euclidean distance, each listed once
+ */
+std::vector<WeightedEdge> nearestNeighborEdges(const std::vector<std::pair<double, double>> &points,
+                                               int k,
+                                               int numThreads = 0)
+{
+    int n = points.size();
+    k = std::min(k, n - 1);
+    if (k <= 0)
+    {
+        return {};
+    }
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<int> neighbors = nearestNeighborLists(points, k, numThreads);
+
+    // Emit each undirected edge once: from the smaller index, or from the only endpoint that lists it
+    std::vector<std::vector<WeightedEdge>> localEdges(numThreads);
+    runOnThreads(numThreads, [&](int t)
+                 {
+        auto &out = localEdges[t];
+        for (int i = n * static_cast<long long>(t) / numThreads; i < n * static_cast<long long>(t + 1) / numThreads; i++)
+        {
+            for (int a = 0; a < k; a++)
+            {
+                int j = neighbors[static_cast<size_t>(i) * k + a];
+                bool listedByJ = false;
+                for (int b = 0; b < k && !listedByJ; b++)
+                {
+                    listedByJ = neighbors[static_cast<size_t>(j) * k + b] == i;
+                }
+                if (i < j || !listedByJ)
+                {
+                    double dx = points[i].first - points[j].first, dy = points[i].second - points[j].second;
+                    out.push_back({std::sqrt(dx * dx + dy * dy), i, j});
+                }
+            }
+        } });
+
+    std::vector<WeightedEdge> edges;
+    for (auto &local : localEdges)
+    {
+        edges.insert(edges.end(), local.begin(), local.end());
+    }
+    return edges;
+}
+
+/****************************************************************************************
+ * TOUR IMPROVEMENT (2-OPT AND OR-OPT LOCAL SEARCH)
+ ****************************************************************************************/
+
+/**
+ * @brief 2-opt and Or-opt local search for Euclidean TSP tours
+ *
+ * Only moves that connect a city to one of its k nearest neighbors are tried, and a
+ * move is only worth trying if that new edge is shorter than the tour edge it
+ * replaces, so each city scans a short prefix of its sorted candidate list. Each move
+ * is priced in O(1) from the few edges it removes and adds.
+ *
+ * Don't-look bits: a city whose neighborhood yielded no improvement is left out until
+ * a move touches one of its tour edges again. Active cities wait in a FIFO queue.
+ *
+ * The tour is an array of cities plus the position of every city. A 2-opt move reverses
+ * the shorter side of the cycle, and an Or-opt move (shifting a segment of 1-3 cities
+ * elsewhere, possibly reversed) is applied as two or three 2-opt moves.
+ */
+class TourLocalSearch
+{
+private:
+    static constexpr double EPSILON = 1e-10;
+    static const int MAX_SEGMENT = 3;
+
+    const std::vector<std::pair<double, double>> &points;
+    std::vector<int> neighbors; // neighbors[i * k + j] = j-th nearest neighbor of i
+    int n;
+    int k;
+
+    std::vector<int> tour;     // tour[p] = city at position p
+    std::vector<int> position; // position[c] = position of city c
+    std::vector<char> queued;
+    std::deque<int> active;
+
+    double dist(int a, int b) const
+    {
+        double dx = points[a].first - points[b].first, dy = points[a].second - points[b].second;
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    int next(int c) const { return tour[position[c] + 1 == n ? 0 : position[c] + 1]; }
+    int prev(int c) const { return tour[position[c] == 0 ? n - 1 : position[c] - 1]; }
+
+    // Positions from city a forward to city b (0 when a == b)
+    int forwardSteps(int a, int b) const
+    {
+        int steps = position[b] - position[a];
+        return steps < 0 ? steps + n : steps;
+    }
+
+    void activate(int c)
+    {
+        if (!queued[c])
+        {
+            queued[c] = 1;
+            active.push_back(c);
+        }
+    }
+
+    // Reverse the tour path from city a forward to city b, or the rest of the cycle if shorter
+    void reversePath(int a, int b)
+    {
+        int inner = forwardSteps(a, b) + 1;
+        if (2 * inner > n)
+        {
+            int outerStart = next(b);
+            b = prev(a);
+            a = outerStart;
+            inner = n - inner;
+        }
+
+        int i = position[a], j = position[b];
+        for (int swaps = inner / 2; swaps > 0; swaps--)
+        {
+            std::swap(tour[i], tour[j]);
+            position[tour[i]] = i;
+            position[tour[j]] = j;
+            i = i + 1 == n ? 0 : i + 1;
+            j = j == 0 ? n - 1 : j - 1;
+        }
+    }
+
+    // Replace tour edges (t1, t2) and (t3, t4), where t2 follows t1 and t4 follows t3 in the
+    // same direction, with (t1, t3) and (t2, t4)
+    void twoOptMove(int t1, int t2, int t3, int t4)
+    {
+        if (next(t1) == t2)
+        {
+            reversePath(t2, t3);
+        }
+        else
+        {
+            reversePath(t1, t4);
+        }
+    }
+
+    // Try every 2-opt move that adds an edge from a to one of its neighbors
+    bool tryTwoOpt(int a)
+    {
+        for (int direction = 0; direction < 2; direction++)
+        {
+            int b = direction == 0 ? next(a) : prev(a);
+            double removed = dist(a, b);
+
+            for (int j = 0; j < k; j++)
+            {
+                int c = neighbors[static_cast<size_t>(a) * k + j];
+                double added = dist(a, c);
+                if (added >= removed - EPSILON)
+                {
+                    break;
+                }
+
+                int d = direction == 0 ? next(c) : prev(c);
+                if (c == b || d == a)
+                {
+                    continue;
+                }
+
+                double delta = added + dist(b, d) - removed - dist(c, d);
+                if (delta < -EPSILON)
+                {
+                    twoOptMove(a, b, c, d);
+                    for (int city : {a, b, c, d})
+                    {
+                        activate(city);
+                    }
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Move the segment first..last (in tour order) between x and y = next(x)
+    void moveSegment(int first, int last, int x, int y, bool reversed)
+    {
+        int before = prev(first), after = next(last);
+
+        // before [first..last] after ... x y  ->  before x ... after [last..first] y
+        twoOptMove(before, first, x, y);
+        if (x != after)
+        {
+            // -> before after ... x [last..first] y
+            twoOptMove(before, x, after, last);
+        }
+        if (!reversed && first != last)
+        {
+            // -> x [first..last] y
+            twoOptMove(x, last, first, y);
+        }
+    }
+
+    // Try moving a segment of 1-3 cities that starts or ends at a next to one of a's neighbors
+    bool tryOrOpt(int a)
+    {
+        for (int length = 1; length <= MAX_SEGMENT && length < n - 2; length++)
+        {
+            for (int direction = 0; direction < (length == 1 ? 1 : 2); direction++)
+            {
+                // Segment first..last in tour order, with a at one end
+                int first = a, last = a;
+                for (int step = 1; step < length; step++)
+                {
+                    if (direction == 0)
+                    {
+                        last = next(last);
+                    }
+                    else
+                    {
+                        first = prev(first);
+                    }
+                }
+                int before = prev(first), after = next(last);
+                double removalGain = dist(before, first) + dist(last, after) - dist(before, after);
+                int other = a == first ? last : first;
+
+                for (int j = 0; j < k; j++)
+                {
+                    int c = neighbors[static_cast<size_t>(a) * k + j];
+                    if (dist(a, c) >= removalGain - EPSILON)
+                    {
+                        break;
+                    }
+                    if (forwardSteps(first, c) < length)
+                    {
+                        continue;
+                    }
+
+                    // Insert so that a is adjacent to c, on either side of c
+                    for (int side = 0; side < 2; side++)
+                    {
+                        int x = side == 0 ? c : prev(c);
+                        int y = side == 0 ? next(c) : c;
+                        if (x == last || y == first || y == before)
+                        {
+                            continue;
+                        }
+
+                        int nearX = side == 0 ? a : other;
+                        int nearY = side == 0 ? other : a;
+                        double delta = dist(x, nearX) + dist(nearY, y) - dist(x, y) - removalGain;
+                        if (delta < -EPSILON)
+                        {
+                            // Kept orientation when first ends up next to x
+                            moveSegment(first, last, x, y, nearX != first);
+                            for (int city : {before, after, first, last, x, y})
+                            {
+                                activate(city);
+                            }
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param points City coordinates, indexed by dense index
+     * @param k Number of candidate neighbors per city
+     * @param numThreads Threads for building the candidate lists (0 = hardware concurrency)
+     */
+    TourLocalSearch(const std::vector<std::pair<double, double>> &points, int k, int numThreads = 0)
+        : points(points), n(points.size()), k(std::max(0, std::min(k, static_cast<int>(points.size()) - 1)))
+    {
+        if (this->k > 0)
+        {
+            neighbors = nearestNeighborLists(points, this->k, numThreads);
+        }
     }
 
-    std::unordered_set<int> visited;
-    std::queue<int> queue;
-
-    // Start BFS from the first vertex
-    int start = vertices[0];
-    visited.insert(start);
-    queue.push(start);
-
-    while (!queue.empty())
+    /**
+     * @brief Improve a tour until no candidate move helps
+     *
+     * Time complexity: O(k) per move tried, plus O(n) per applied move for the reversal
+     * (usually much less, since candidate moves tend to reverse short paths)
+     *
+     * @param route Order of the cities (each dense index once); improved in place
+     * @param useOrOpt Also try Or-opt segment moves, not just 2-opt
+     * @return Length of the improved tour
+     */
+    double improve(std::vector<int> &route, bool useOrOpt = true)
     {
-        int current = queue.front();
-        queue.pop();
+        tour = route;
+        position.assign(n, 0);
+        for (int p = 0; p < n; p++)
+        {
+            position[tour[p]] = p;
+        }
 
-        for (int neighbor : graph.getNeighbors(current))
+        if (n >= 5)
         {
-            if (visited.find(neighbor) == visited.end())
+            queued.assign(n, 0);
+            active.clear();
+            for (int city : tour)
             {
-                visited.insert(neighbor);
-                queue.push(neighbor);
+                activate(city);
+            }
+
+            while (!active.empty())
+            {
+                int a = active.front();
+                active.pop_front();
+                queued[a] = 0;
+
+                // Keep working on a while it yields improvements
+                while (tryTwoOpt(a) || (useOrOpt && tryOrOpt(a)))
+                {
+                }
             }
         }
+
+        route = tour;
+        return tourLength(route);
     }
 
-    // Check if all vertices are visited
-    return visited.size() == vertices.size();
-}
+    /**
+     * @brief Length of the closed tour visiting route in order
+     */
+    double tourLength(const std::vector<int> &route) const
+    {
+        double length = 0.0;
+        for (size_t i = 0; i < route.size(); i++)
+        {
+            length += dist(route[i], route[(i + 1) % route.size()]);
+        }
+        return length;
+    }
+};
 
 /**
- * @brief Implementation of the Reverse-Delete algorithm for finding the MST
- *
- * The Reverse-Delete algorithm starts with all edges and removes them in order of
- * decreasing weight, as long as removing the edge doesn't disconnect the graph.
+ * @brief Double-tree tour: preorder walk of a spanning forest
  *
- * Time Complexity: O(E log E) for sorting, O(E(V+E)) for connectivity checks
- * Space Complexity: O(V + E)
+ * Shortcutting the doubled MST gives a tour at most twice the optimum (for a spanning
+ * tree under the triangle inequality). Components of a forest are visited one after another.
  *
- * @param graph The graph to find the MST for
- * @param totalWeight Output parameter for the total weight of the MST
- * @return Vector of (source, destination) pairs representing MST edges
+ * @param numVertices Number of vertices
+ * @param forest Forest edges over dense indices
+ * @return Order of the vertices
  */
-std::vector<std::pair<int, int>> reverseDeleteMST(const IGraph &graph, double &totalWeight)
+std::vector<int> doubleTreeTour(int numVertices, const std::vector<WeightedEdge> &forest)
 {
-    std::vector<int> vertices = graph.getVertices();
-    int n = vertices.size();
-
-    // Get all edges from the graph
-    std::vector<std::tuple<double, int, int>> edges;
-
-    for (int u : vertices)
+    std::vector<int> degree(numVertices + 1, 0);
+    for (const auto &edge : forest)
     {
-        for (int v : graph.getNeighbors(u))
-        {
-            // For undirected graphs, add each edge only once
-            if (!graph.isDirected() && u < v)
-            {
-                double weight = graph.getEdgeWeight(u, v);
-                edges.push_back({weight, u, v});
-            }
-            else if (graph.isDirected())
-            {
-                double weight = graph.getEdgeWeight(u, v);
-                edges.push_back({weight, u, v});
-            }
-        }
+        degree[edge.u + 1]++;
+        degree[edge.v + 1]++;
     }
-
-    // Sort edges by weight in descending order
-    std::sort(edges.begin(), edges.end(), std::greater<std::tuple<double, int, int>>());
-
-    // Create a copy of the graph
-    auto mstGraph = std::make_unique<AdjacencyListGraph>(false, true);
-
-    // Add all vertices
-    for (int v : vertices)
+    for (int v = 0; v < numVertices; v++)
     {
-        mstGraph->addVertex(v);
+        degree[v + 1] += degree[v];
     }
-
-    // Add all edges
-    for (const auto &[weight, u, v] : edges)
+    std::vector<int> adjacency(2 * forest.size());
+    std::vector<int> fill(degree.begin(), degree.end() - 1);
+    for (const auto &edge : forest)
     {
-        mstGraph->addEdge(u, v, weight);
+        adjacency[fill[edge.u]++] = edge.v;
+        adjacency[fill[edge.v]++] = edge.u;
     }
 
-    // Process edges in order of decreasing weight
-    for (const auto &[weight, u, v] : edges)
+    std::vector<int> order;
+    order.reserve(numVertices);
+    std::vector<bool> visited(numVertices, false);
+    std::vector<int> stack;
+    for (int root = 0; root < numVertices; root++)
     {
-        // Temporarily remove the edge
-        mstGraph->removeEdge(u, v);
-
-        // Check if the graph is still connected
-        bool connected = isConnected(*mstGraph);
-
-        // If removing the edge disconnects the graph, add it back
-        if (!connected)
+        if (visited[root])
         {
-            mstGraph->addEdge(u, v, weight);
+            continue;
         }
-    }
-
-    // Extract the MST edges
-    std::vector<std::pair<int, int>> mstEdges;
-    totalWeight = 0.0;
-
-    for (int u : vertices)
-    {
-        for (int v : mstGraph->getNeighbors(u))
+        stack.push_back(root);
+        visited[root] = true;
+        while (!stack.empty())
         {
-            // For undirected graphs, add each edge only once
-            if (u < v)
+            int u = stack.back();
+            stack.pop_back();
+            order.push_back(u);
+            for (int e = degree[u + 1] - 1; e >= degree[u]; e--)
             {
-                double weight = mstGraph->getEdgeWeight(u, v);
-                mstEdges.push_back({u, v});
-                totalWeight += weight;
+                if (!visited[adjacency[e]])
+                {
+                    visited[adjacency[e]] = true;
+                    stack.push_back(adjacency[e]);
+                }
             }
         }
     }
-
-    return mstEdges;
+    return order;
 }
 
 /****************************************************************************************
@@ -1258,17 +2350,79 @@ public:
     }
 
     /**
-     * @brief Compute the optimal network design using Kruskal's algorithm
+     * @brief Generate connections only to each location's k nearest neighbors
+     *
+     * Unlike generateConnections(), this never enumerates all pairs, so it scales to
+     * millions of locations. See nearestNeighborEdges() for the spanning caveat.
+     *
+     * @param k Number of nearest neighbors per location
+     */
+    void generateNearestConnections(int k = 8)
+    {
+        std::vector<int> locations = networkGraph->getVertices();
+        std::vector<std::pair<double, double>> points;
+        points.reserve(locations.size());
+        for (int loc : locations)
+        {
+            points.push_back(coordinates[loc]);
+        }
+
+        for (const auto &edge : nearestNeighborEdges(points, k))
+        {
+            networkGraph->addEdge(locations[edge.u], locations[edge.v], edge.weight);
+        }
+    }
+
+    /**
+     * @brief Compute the optimal network design using filter-Kruskal
      *
      * @return Pair of (connections, total cost)
      */
     std::pair<std::vector<std::pair<int, int>>, double> designOptimalNetwork()
     {
         double totalCost;
-        auto connections = kruskalMST(*networkGraph, totalCost);
+        auto connections = filterKruskalMST(*networkGraph, totalCost);
         return {connections, totalCost};
     }
 
+    /**
+     * @brief Compute the network design for many locations without building the graph
+     *
+     * Candidate links come from the k-nearest-neighbor graph and the MST is found with
+     * parallel Borůvka. If the candidates do not connect every location, k is doubled
+     * and the design is recomputed.
+     *
+     * @param k Initial number of nearest neighbors per location
+     * @param numThreads Number of threads (0 = hardware concurrency)
+     * @return Pair of (connections, total cost)
+     */
+    std::pair<std::vector<std::pair<int, int>>, double> designLargeNetwork(int k = 8, int numThreads = 0)
+    {
+        std::vector<int> locations = networkGraph->getVertices();
+        std::vector<std::pair<double, double>> points;
+        points.reserve(locations.size());
+        for (int loc : locations)
+        {
+            points.push_back(coordinates[loc]);
+        }
+
+        int n = locations.size();
+        double totalCost = 0.0;
+        std::vector<WeightedEdge> forest;
+        while (true)
+        {
+            auto candidates = nearestNeighborEdges(points, k, numThreads);
+            forest = parallelBoruvkaForest(n, candidates, totalCost, numThreads);
+            if (static_cast<int>(forest.size()) >= n - 1 || k >= n - 1)
+            {
+                break;
+            }
+            k *= 2;
+        }
+
+        return {toSpanningTree(forest, locations, totalCost), totalCost};
+    }
+
     /**
      * @brief Get the coordinates of a location
      *
@@ -1732,6 +2886,46 @@ public:
         return tspRoute;
     }
 
+    /**
+     * @brief Improve a tour with 2-opt and Or-opt moves between nearest neighbors
+     *
+     * @param route Closed route as returned by approximateTSPSolution()
+     * @param k Number of candidate neighbors per city
+     * @return Improved closed route starting and ending at the same city
+     */
+    std::vector<int> improveTour(const std::vector<int> &route, int k = 10)
+    {
+        if (route.size() < 2)
+        {
+            return route;
+        }
+
+        // Dense indices in route order, so the identity permutation is the input tour
+        int numCities = route.size() - 1;
+        std::vector<std::pair<double, double>> points;
+        points.reserve(numCities);
+        for (int i = 0; i < numCities; i++)
+        {
+            points.push_back(coordinates.at(route[i]));
+        }
+
+        std::vector<int> order(numCities);
+        std::iota(order.begin(), order.end(), 0);
+        TourLocalSearch search(points, k);
+        search.improve(order);
+
+        // Start from the same city as the input
+        std::rotate(order.begin(), std::find(order.begin(), order.end(), 0), order.end());
+        std::vector<int> improved;
+        improved.reserve(route.size());
+        for (int index : order)
+        {
+            improved.push_back(route[index]);
+        }
+        improved.push_back(improved[0]);
+        return improved;
+    }
+
     /**
      * @brief Find an Eulerian circuit in the graph
      *
@@ -2132,6 +3326,225 @@ void benchmarkMSTDenseVsSparse(
     std::cout << std::endl;
 }
 
+/**
+ * @brief Benchmark MST algorithms on a large Euclidean instance
+ *
+ * Builds k-nearest-neighbor candidate edges for uniformly random points and compares
+ * sort-everything Kruskal, filter-Kruskal and parallel Borůvka on them. For small
+ * instances the result is also checked against the exact Euclidean MST computed by
+ * O(n²) Prim on the complete graph.
+ *
+ * @param numPoints Number of points
+ * @param k Number of nearest neighbors per point
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ */
+void benchmarkLargeScaleMST(int numPoints, int k, int numThreads = 0)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::cout << "===== Large-Scale Euclidean MST Benchmark =====" << std::endl;
+    std::cout << "Points: " << numPoints << ", k: " << k << ", Threads: " << numThreads << std::endl;
+
+    std::mt19937 gen(32);
+    std::uniform_real_distribution<> coordDistr(0.0, 1000.0);
+    std::vector<std::pair<double, double>> points(numPoints);
+    for (auto &point : points)
+    {
+        point = {coordDistr(gen), coordDistr(gen)};
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    auto edges = nearestNeighborEdges(points, k, numThreads);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> duration = end - start;
+
+    std::cout << "k-NN candidate edges: " << edges.size() << " (complete graph: "
+              << static_cast<long long>(numPoints) * (numPoints - 1) / 2 << ") built in "
+              << std::fixed << std::setprecision(2) << duration.count() << " ms" << std::endl
+              << std::endl;
+
+    std::cout << std::left << std::setw(25) << "Algorithm"
+              << std::setw(15) << "Time (ms)"
+              << std::setw(20) << "Total Weight"
+              << std::setw(12) << "Spanning"
+              << std::setw(12) << "Same Result"
+              << std::endl;
+
+    std::cout << std::string(84, '-') << std::endl;
+
+    double referenceWeight = 0.0;
+    auto report = [&](const std::string &name, const std::function<std::vector<WeightedEdge>(double &)> &run)
+    {
+        double totalWeight = 0.0;
+        auto startRun = std::chrono::high_resolution_clock::now();
+        auto forest = run(totalWeight);
+        auto endRun = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> runDuration = endRun - startRun;
+
+        if (name == "Kruskal (full sort)")
+        {
+            referenceWeight = totalWeight;
+        }
+
+        std::cout << std::left << std::setw(25) << name
+                  << std::setw(15) << std::fixed << std::setprecision(2) << runDuration.count()
+                  << std::setw(20) << std::fixed << std::setprecision(4) << totalWeight
+                  << std::setw(12) << (static_cast<int>(forest.size()) == numPoints - 1 ? "Yes" : "No")
+                  << std::setw(12) << (std::abs(totalWeight - referenceWeight) <= 1e-9 * referenceWeight ? "Yes" : "No")
+                  << std::endl;
+        return totalWeight;
+    };
+
+    report("Kruskal (full sort)", [&](double &w)
+           { return kruskalForest(numPoints, edges, w); });
+    report("Filter-Kruskal", [&](double &w)
+           { return filterKruskalForest(numPoints, edges, w); });
+    report("Parallel Borůvka", [&](double &w)
+           { return parallelBoruvkaForest(numPoints, edges, w, numThreads); });
+
+    if (numPoints <= 20000)
+    {
+        // Exact Euclidean MST with O(n²) Prim on the implicit complete graph
+        std::vector<double> key(numPoints, std::numeric_limits<double>::infinity());
+        std::vector<bool> inTree(numPoints, false);
+        double exactWeight = 0.0;
+        key[0] = 0.0;
+
+        auto startPrim = std::chrono::high_resolution_clock::now();
+        for (int iter = 0; iter < numPoints; iter++)
+        {
+            int u = -1;
+            for (int v = 0; v < numPoints; v++)
+            {
+                if (!inTree[v] && (u == -1 || key[v] < key[u]))
+                {
+                    u = v;
+                }
+            }
+            inTree[u] = true;
+            exactWeight += std::sqrt(key[u]);
+
+            for (int v = 0; v < numPoints; v++)
+            {
+                double dx = points[u].first - points[v].first, dy = points[u].second - points[v].second;
+                key[v] = inTree[v] ? key[v] : std::min(key[v], dx * dx + dy * dy);
+            }
+        }
+        auto endPrim = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> primDuration = endPrim - startPrim;
+
+        std::cout << std::left << std::setw(25) << "Prim (complete graph)"
+                  << std::setw(15) << std::fixed << std::setprecision(2) << primDuration.count()
+                  << std::setw(20) << std::fixed << std::setprecision(4) << exactWeight
+                  << std::setw(12) << "Yes"
+                  << std::setw(12) << (std::abs(exactWeight - referenceWeight) <= 1e-9 * exactWeight ? "Yes" : "No")
+                  << std::endl;
+    }
+
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Benchmark tour construction and local search on a large Euclidean instance
+ *
+ * Starts from the double-tree tour of the MST over k-NN candidate edges (the scalable
+ * version of TSPApproximator) and improves it with neighbor-list 2-opt, then 2-opt plus
+ * Or-opt. Tour lengths are also given relative to the MST weight, a lower bound on the
+ * optimal tour. Small instances also run classic 2-opt over all pairs of edges.
+ *
+ * @param numPoints Number of points
+ * @param k Number of candidate neighbors per point
+ * @param numThreads Number of threads for the candidate lists (0 = hardware concurrency)
+ */
+void benchmarkTourImprovement(int numPoints, int k, int numThreads = 0)
+{
+    std::cout << "===== TSP Local Search Benchmark =====" << std::endl;
+    std::cout << "Points: " << numPoints << ", k: " << k << std::endl;
+
+    std::mt19937 gen(46);
+    std::uniform_real_distribution<> coordDistr(0.0, 1000.0);
+    std::vector<std::pair<double, double>> points(numPoints);
+    for (auto &point : points)
+    {
+        point = {coordDistr(gen), coordDistr(gen)};
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    double mstWeight = 0.0;
+    auto forest = filterKruskalForest(numPoints, nearestNeighborEdges(points, k, numThreads), mstWeight);
+    std::vector<int> initialTour = doubleTreeTour(numPoints, forest);
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> duration = end - start;
+
+    TourLocalSearch search(points, k, numThreads);
+
+    std::cout << std::left << std::setw(25) << "Algorithm"
+              << std::setw(15) << "Time (ms)"
+              << std::setw(20) << "Tour Length"
+              << std::setw(12) << "vs MST"
+              << std::endl;
+    std::cout << std::string(72, '-') << std::endl;
+
+    auto report = [&](const std::string &name, double milliseconds, double length)
+    {
+        std::cout << std::left << std::setw(25) << name
+                  << std::setw(15) << std::fixed << std::setprecision(2) << milliseconds
+                  << std::setw(20) << std::fixed << std::setprecision(2) << length
+                  << std::setw(12) << std::fixed << std::setprecision(3) << length / mstWeight
+                  << std::endl;
+    };
+
+    report("Double tree (k-NN MST)", duration.count(), search.tourLength(initialTour));
+
+    for (bool useOrOpt : {false, true})
+    {
+        std::vector<int> tour = initialTour;
+        auto startSearch = std::chrono::high_resolution_clock::now();
+        double length = search.improve(tour, useOrOpt);
+        auto endSearch = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> searchDuration = endSearch - startSearch;
+        report(useOrOpt ? "2-opt + Or-opt" : "2-opt (neighbor lists)", searchDuration.count(), length);
+    }
+
+    if (numPoints <= 2000)
+    {
+        // Classic 2-opt: scan every pair of tour edges until no exchange helps
+        std::vector<int> tour = initialTour;
+        auto dist = [&](int a, int b)
+        {
+            double dx = points[a].first - points[b].first, dy = points[a].second - points[b].second;
+            return std::sqrt(dx * dx + dy * dy);
+        };
+
+        auto startFull = std::chrono::high_resolution_clock::now();
+        bool improved = true;
+        while (improved)
+        {
+            improved = false;
+            for (int i = 0; i < numPoints - 1; i++)
+            {
+                for (int j = i + 2; j < numPoints - (i == 0 ? 1 : 0); j++)
+                {
+                    int a = tour[i], b = tour[i + 1], c = tour[j], d = tour[(j + 1) % numPoints];
+                    if (dist(a, c) + dist(b, d) < dist(a, b) + dist(c, d) - 1e-10)
+                    {
+                        std::reverse(tour.begin() + i + 1, tour.begin() + j + 1);
+                        improved = true;
+                    }
+                }
+            }
+        }
+        auto endFull = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double, std::milli> fullDuration = endFull - startFull;
+        report("2-opt (all pairs)", fullDuration.count(), search.tourLength(tour));
+    }
+
+    std::cout << std::endl;
+}
+
 /****************************************************************************************
  * DEMONSTRATION FUNCTIONS
  ****************************************************************************************/
@@ -2361,13 +3774,23 @@ void demoTSPApproximation()
     double totalCost = tsp.getRouteCost(route);
 
     std::cout << "The MST-based TSP approximation has a total cost of " << totalCost << std::endl;
+
+    // Improve the tour with 2-opt and Or-opt local search
+    std::vector<int> improvedRoute = tsp.improveTour(route);
+    std::cout << "After 2-opt / Or-opt local search the total cost is "
+              << tsp.getRouteCost(improvedRoute) << std::endl;
 }
 
 /**
  * @brief Main function
+ *
+ * Pass --large to also run the million-point benchmarks (minutes and gigabytes);
+ * by default only the demo-size runs are made.
  */
-int main()
+int main(int argc, char *argv[])
 {
+    bool runLarge = argc > 1 && std::string(argv[1]) == "--large";
+
     std::cout << "======================================================" << std::endl;
     std::cout << "=== DAY 32: MINIMUM SPANNING TREES                 ===" << std::endl;
     std::cout << "=== Part of #DSAin45 Course                        ===" << std::endl;
@@ -2399,6 +3822,14 @@ int main()
 
     benchmarkMSTAlgorithms({50, 100, 200}, {0.05, 0.2}, 2);
     benchmarkMSTDenseVsSparse({100, 200, 300}, 2);
+    benchmarkLargeScaleMST(20000, 8);
+    if (runLarge)
+    {
+        benchmarkLargeScaleMST(1000000, 8);
+    }
+    benchmarkTourImprovement(1000, 10);
+    benchmarkTourImprovement(10000, 10);
+    benchmarkTourImprovement(100000, 10);
 
     std::cout << "======================================================" << std::endl;
     std::cout << "=== End of DAY 32 Demonstrations                   ===" << std::endl;
@@ -3,8 +3,11 @@
  *
  * This file implements:
  * 1. Strongly Connected Components (Kosaraju's and Tarjan's algorithms)
+ *    - Iterative versions that do not overflow the stack on large graphs
+ *    - Parallel forward-backward SCC with trimming, and a CSR condensation DAG
  * 2. Articulation Points and Bridges
  * 3. Flow Networks (Ford-Fulkerson and Edmonds-Karp algorithms)
+ *    - Highest-label push-relabel with gap and global-relabel heuristics
  *
  * Author: #DSAin45
  * Date: May 2025
@@ -21,6 +24,12 @@
 #include <chrono>
 #include <iomanip>
 #include <string>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <array>
+#include <cmath>
 
 using namespace std;
 
@@ -29,96 +38,60 @@ using namespace std;
 // ===================================================
 
 /**
- * DirectedGraph class for SCC algorithms
+ * Directed graph in compressed sparse row (CSR) form, with its reverse alongside
+ *
+ * Out-edges of v are targets[offsets[v] .. offsets[v + 1]) and in-edges are
+ * sources[inOffsets[v] .. inOffsets[v + 1]). Both halves are built with counting
+ * passes, so neighbor order follows the order in which edges were given.
  */
-class DirectedGraph
+struct CSRDigraph
 {
-private:
-    int V;                   // Number of vertices
-    vector<vector<int>> adj; // Adjacency list
+    int V = 0;
+    vector<int> offsets;   // V + 1 row starts into targets
+    vector<int> targets;   // Out-neighbors
+    vector<int> inOffsets; // V + 1 row starts into sources
+    vector<int> sources;   // In-neighbors
 
-    // Kosaraju's Algorithm helpers
+    CSRDigraph() = default;
 
-    // Fill order of vertices in stack according to their finishing times
-    void fillOrder(int v, vector<bool> &visited, stack<int> &Stack)
+    // Build from an edge list of (from, to) pairs
+    CSRDigraph(int vertices, const vector<pair<int, int>> &edges) : V(vertices)
     {
-        visited[v] = true;
-
-        // Recur for all adjacent vertices
-        for (int neighbor : adj[v])
+        offsets.assign(V + 1, 0);
+        inOffsets.assign(V + 1, 0);
+        for (const auto &[u, v] : edges)
         {
-            if (!visited[neighbor])
-            {
-                fillOrder(neighbor, visited, Stack);
-            }
+            offsets[u + 1]++;
+            inOffsets[v + 1]++;
         }
-
-        // Push current vertex to stack when all its adjacent vertices are processed
-        Stack.push(v);
-    }
-
-    // DFS traversal to find components
-    void DFSUtil(int v, vector<bool> &visited, vector<int> &component)
-    {
-        visited[v] = true;
-        component.push_back(v);
-
-        // Recur for all adjacent vertices
-        for (int neighbor : adj[v])
+        for (int v = 0; v < V; v++)
         {
-            if (!visited[neighbor])
-            {
-                DFSUtil(neighbor, visited, component);
-            }
+            offsets[v + 1] += offsets[v];
+            inOffsets[v + 1] += inOffsets[v];
         }
-    }
-
-    // Tarjan's Algorithm helpers
-
-    // Recursive function for Tarjan's SCC algorithm
-    void tarjanSCCUtil(int u, vector<int> &disc, vector<int> &low,
-                       stack<int> &st, vector<bool> &stackMember,
-                       vector<vector<int>> &SCCs, int &time)
-    {
-        // Initialize discovery time and low value
-        disc[u] = low[u] = ++time;
-        st.push(u);
-        stackMember[u] = true;
 
-        // Go through all adjacent vertices
-        for (int v : adj[u])
+        targets.resize(edges.size());
+        sources.resize(edges.size());
+        vector<int> outPos(offsets.begin(), offsets.end() - 1);
+        vector<int> inPos(inOffsets.begin(), inOffsets.end() - 1);
+        for (const auto &[u, v] : edges)
         {
-            // If v is not visited yet, recur for it
-            if (disc[v] == -1)
-            {
-                tarjanSCCUtil(v, disc, low, st, stackMember, SCCs, time);
-
-                // Check if the subtree rooted with v has a connection to one of the ancestors of u
-                low[u] = min(low[u], low[v]);
-            }
-            // If v is on stack, update low value of u
-            else if (stackMember[v])
-            {
-                low[u] = min(low[u], disc[v]);
-            }
+            targets[outPos[u]++] = v;
+            sources[inPos[v]++] = u;
         }
+    }
 
-        // Head of SCC found, pop the stack and print SCC
-        if (low[u] == disc[u])
-        {
-            vector<int> component;
-            int w;
-            do
-            {
-                w = st.top();
-                st.pop();
-                stackMember[w] = false;
-                component.push_back(w);
-            } while (w != u);
+    int edgeCount() const { return targets.size(); }
+};
 
-            SCCs.push_back(component);
-        }
-    }
+/**
+ * DirectedGraph class for SCC algorithms
+ */
+class DirectedGraph
+{
+private:
+    int V;                   // Number of vertices
+    vector<vector<int>> adj; // Adjacency list
 
 public:
     // Constructor
@@ -148,6 +121,32 @@ public:
         return g;
     }
 
+    // Number of edges
+    int getEdgeCount() const
+    {
+        int count = 0;
+        for (const auto &neighbors : adj)
+        {
+            count += neighbors.size();
+        }
+        return count;
+    }
+
+    // CSR copy of the graph (with reverse edges) for the scalable SCC algorithms
+    CSRDigraph toCSR() const
+    {
+        vector<pair<int, int>> edges;
+        edges.reserve(getEdgeCount());
+        for (int v = 0; v < V; v++)
+        {
+            for (int neighbor : adj[v])
+            {
+                edges.push_back({v, neighbor});
+            }
+        }
+        return CSRDigraph(V, edges);
+    }
+
     // Print adjacency list representation of graph
     void printGraph()
     {
@@ -163,50 +162,98 @@ public:
     }
 
     // Kosaraju's algorithm to find strongly connected components
+    //
+    // Both DFS passes use an explicit stack of (vertex, next edge) frames, so the
+    // depth of the graph is not limited by the call stack. The second pass walks the
+    // in-edges of a CSR copy instead of building a transposed DirectedGraph.
     vector<vector<int>> kosarajuSCC()
     {
         vector<vector<int>> SCCs;
+        vector<pair<int, int>> frames;
 
-        // Create a stack for DFS
-        stack<int> Stack;
-
-        // Mark all vertices as not visited (for first DFS)
+        // Record vertices by finishing time (first DFS)
+        vector<int> order;
+        order.reserve(V);
         vector<bool> visited(V, false);
 
-        // Fill vertices in stack according to their finishing times
         for (int i = 0; i < V; i++)
         {
-            if (!visited[i])
+            if (visited[i])
             {
-                fillOrder(i, visited, Stack);
+                continue;
+            }
+
+            visited[i] = true;
+            frames.push_back({i, 0});
+            while (!frames.empty())
+            {
+                auto &[v, next] = frames.back();
+                if (next < static_cast<int>(adj[v].size()))
+                {
+                    int neighbor = adj[v][next++];
+                    if (!visited[neighbor])
+                    {
+                        visited[neighbor] = true;
+                        frames.push_back({neighbor, 0});
+                    }
+                }
+                else
+                {
+                    // All adjacent vertices processed: v finishes
+                    order.push_back(v);
+                    frames.pop_back();
+                }
             }
         }
 
-        // Create a reversed graph
-        DirectedGraph gr = getTranspose();
+        // In-edges of the CSR copy are the edges of the transposed graph
+        CSRDigraph csr = toCSR();
 
         // Mark all vertices as not visited (for second DFS)
         fill(visited.begin(), visited.end(), false);
 
-        // Process all vertices in order defined by Stack
-        while (!Stack.empty())
+        // Process vertices in decreasing finishing time
+        for (auto it = order.rbegin(); it != order.rend(); ++it)
         {
-            int v = Stack.top();
-            Stack.pop();
+            if (visited[*it])
+            {
+                continue;
+            }
 
-            // If not visited, it's a new SCC
-            if (!visited[v])
+            // Not visited: it's a new SCC
+            vector<int> component;
+            visited[*it] = true;
+            component.push_back(*it);
+            frames.push_back({*it, csr.inOffsets[*it]});
+            while (!frames.empty())
             {
-                vector<int> component;
-                gr.DFSUtil(v, visited, component);
-                SCCs.push_back(component);
+                auto &[v, next] = frames.back();
+                if (next < csr.inOffsets[v + 1])
+                {
+                    int neighbor = csr.sources[next++];
+                    if (!visited[neighbor])
+                    {
+                        visited[neighbor] = true;
+                        component.push_back(neighbor);
+                        frames.push_back({neighbor, csr.inOffsets[neighbor]});
+                    }
+                }
+                else
+                {
+                    frames.pop_back();
+                }
             }
+            SCCs.push_back(component);
         }
 
         return SCCs;
     }
 
     // Tarjan's algorithm to find strongly connected components
+    //
+    // The recursion is replaced by an explicit stack of (vertex, next edge) frames;
+    // when a frame is popped its low value is propagated to its parent frame, exactly
+    // where the recursive version would return. Output is identical.
     vector<vector<int>> tarjanSCC()
     {
         vector<int> disc(V, -1);
@@ -214,14 +261,70 @@ public:
         vector<bool> stackMember(V, false);
         stack<int> st;
         vector<vector<int>> SCCs;
+        vector<pair<int, int>> frames;
         int time = 0;
 
-        // Call the recursive helper function for all vertices
         for (int i = 0; i < V; i++)
         {
-            if (disc[i] == -1)
+            if (disc[i] != -1)
             {
-                tarjanSCCUtil(i, disc, low, st, stackMember, SCCs, time);
+                continue;
+            }
+
+            // Initialize discovery time and low value of the DFS root
+            disc[i] = low[i] = ++time;
+            st.push(i);
+            stackMember[i] = true;
+            frames.push_back({i, 0});
+
+            while (!frames.empty())
+            {
+                auto &[u, next] = frames.back();
+
+                if (next < static_cast<int>(adj[u].size()))
+                {
+                    int v = adj[u][next++];
+
+                    // If v is not visited yet, descend into it
+                    if (disc[v] == -1)
+                    {
+                        disc[v] = low[v] = ++time;
+                        st.push(v);
+                        stackMember[v] = true;
+                        frames.push_back({v, 0});
+                    }
+                    // If v is on stack, update low value of u
+                    else if (stackMember[v])
+                    {
+                        low[u] = min(low[u], disc[v]);
+                    }
+                    continue;
+                }
+
+                // Head of SCC found, pop the stack
+                if (low[u] == disc[u])
+                {
+                    vector<int> component;
+                    int w;
+                    do
+                    {
+                        w = st.top();
+                        st.pop();
+                        stackMember[w] = false;
+                        component.push_back(w);
+                    } while (w != u);
+
+                    SCCs.push_back(component);
+                }
+
+                // Return to the parent: the subtree of u may reach one of its ancestors
+                int finished = u;
+                frames.pop_back();
+                if (!frames.empty())
+                {
+                    int parent = frames.back().first;
+                    low[parent] = min(low[parent], low[finished]);
+                }
             }
         }
 
@@ -315,6 +418,523 @@ public:
     }
 };
 
+// ===================================================
+// 1b. SCALABLE SCC: ITERATIVE, PARALLEL, CONDENSATION
+// ===================================================
+
+// Run body(threadId) on numThreads threads (the caller acts as thread 0)
+void runOnThreads(int numThreads, const function<void(int)> &body)
+{
+    vector<thread> workers;
+    workers.reserve(numThreads - 1);
+    for (int t = 1; t < numThreads; t++)
+    {
+        workers.emplace_back(body, t);
+    }
+    body(0);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * Lock-free union-find: CAS on parent links, union by index, path splitting
+ */
+class ConcurrentUnionFind
+{
+private:
+    mutable vector<atomic<int>> parent;
+
+public:
+    ConcurrentUnionFind(int n) : parent(n)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            parent[i].store(i, memory_order_relaxed);
+        }
+    }
+
+    int find(int x) const
+    {
+        while (true)
+        {
+            int p = parent[x].load(memory_order_acquire);
+            if (p == x)
+            {
+                return x;
+            }
+            int grandparent = parent[p].load(memory_order_acquire);
+            if (grandparent != p)
+            {
+                // x is not a root, so any ancestor is a valid parent for it
+                parent[x].store(grandparent, memory_order_release);
+            }
+            x = p;
+        }
+    }
+
+    void unite(int x, int y)
+    {
+        while (true)
+        {
+            x = find(x);
+            y = find(y);
+            if (x == y)
+            {
+                return;
+            }
+            if (x < y)
+            {
+                swap(x, y);
+            }
+            int expected = x;
+            if (parent[x].compare_exchange_strong(expected, y, memory_order_acq_rel))
+            {
+                return;
+            }
+        }
+    }
+};
+
+/**
+ * Tarjan's algorithm over the vertices for which inScope(v) holds
+ *
+ * Iterative (explicit frame stack) so graph depth never touches the call stack.
+ * disc, low and onStack are indexed by vertex and only touched for in-scope vertices,
+ * which lets disjoint scopes run on different threads with shared arrays.
+ * Each SCC found gets the id returned by nextId().
+ */
+template <typename InScope, typename NextId>
+void tarjanScoped(const CSRDigraph &g, const vector<int> &scope, InScope inScope, NextId nextId,
+                  vector<int> &disc, vector<int> &low, vector<char> &onStack, vector<int> &sccId)
+{
+    vector<pair<int, int>> frames; // (vertex, next out-edge position)
+    vector<int> st;
+    int time = 0;
+
+    for (int root : scope)
+    {
+        if (disc[root] != -1)
+        {
+            continue;
+        }
+
+        disc[root] = low[root] = time++;
+        st.push_back(root);
+        onStack[root] = 1;
+        frames.push_back({root, g.offsets[root]});
+
+        while (!frames.empty())
+        {
+            auto &[u, next] = frames.back();
+
+            if (next < g.offsets[u + 1])
+            {
+                int v = g.targets[next++];
+                if (!inScope(v))
+                {
+                    continue;
+                }
+                if (disc[v] == -1)
+                {
+                    disc[v] = low[v] = time++;
+                    st.push_back(v);
+                    onStack[v] = 1;
+                    frames.push_back({v, g.offsets[v]});
+                }
+                else if (onStack[v])
+                {
+                    low[u] = min(low[u], disc[v]);
+                }
+                continue;
+            }
+
+            if (low[u] == disc[u])
+            {
+                int id = nextId();
+                int w;
+                do
+                {
+                    w = st.back();
+                    st.pop_back();
+                    onStack[w] = 0;
+                    sccId[w] = id;
+                } while (w != u);
+            }
+
+            int finished = u;
+            frames.pop_back();
+            if (!frames.empty())
+            {
+                int parent = frames.back().first;
+                low[parent] = min(low[parent], low[finished]);
+            }
+        }
+    }
+}
+
+/**
+ * Iterative Tarjan on a CSR graph
+ *
+ * @param g Graph
+ * @param sccId Output: SCC id of every vertex, in reverse topological order of the
+ *              condensation (like Tarjan's emission order)
+ * @return Number of SCCs
+ */
+int tarjanSCC(const CSRDigraph &g, vector<int> &sccId)
+{
+    vector<int> disc(g.V, -1), low(g.V, 0), all(g.V);
+    vector<char> onStack(g.V, 0);
+    sccId.assign(g.V, -1);
+    for (int v = 0; v < g.V; v++)
+    {
+        all[v] = v;
+    }
+
+    int count = 0;
+    tarjanScoped(
+        g, all, [](int)
+        { return true; },
+        [&count]()
+        { return count++; },
+        disc, low, onStack, sccId);
+    return count;
+}
+
+/**
+ * Parallel SCC decomposition: trimming + forward-backward + parallel Tarjan
+ *
+ * 1. Trim: a vertex with no unassigned in-neighbor or no unassigned out-neighbor is
+ *    an SCC by itself. A few parallel rounds remove most DAG-like parts.
+ * 2. Forward-backward: the vertices both reachable from and reaching a pivot form
+ *    the pivot's SCC. The pivot maximizes in-degree * out-degree, so on real graphs
+ *    it usually lands in the giant SCC. Both searches are level-synchronous
+ *    parallel BFS that claim vertices with atomic flags.
+ * 3. Trim again, then split what is left into weakly connected components with a
+ *    concurrent union-find. No SCC crosses them, so threads run iterative Tarjan on
+ *    different components independently, largest first.
+ *
+ * Time Complexity: O(V + E) work per phase; depth dominated by BFS levels
+ * Space Complexity: O(V + E)
+ *
+ * @param g Graph
+ * @param sccId Output: SCC id of every vertex (ids are 0..count-1, in no particular order)
+ * @param numThreads Number of threads (0 = hardware concurrency)
+ * @return Number of SCCs
+ */
+int parallelSCC(const CSRDigraph &g, vector<int> &sccId, int numThreads = 0)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = max(1u, thread::hardware_concurrency());
+    }
+
+    int n = g.V;
+    vector<atomic<int>> comp(n); // SCC id, -1 while unassigned
+    atomic<int> nextId{0};
+
+    auto range = [&](int t, int total)
+    {
+        return make_pair(static_cast<int>(static_cast<long long>(total) * t / numThreads),
+                         static_cast<int>(static_cast<long long>(total) * (t + 1) / numThreads));
+    };
+
+    runOnThreads(numThreads, [&](int t)
+                 {
+        auto [begin, end] = range(t, n);
+        for (int v = begin; v < end; v++)
+        {
+            comp[v].store(-1, memory_order_relaxed);
+        } });
+
+    // Phase 1 / 3: trimming. Seeing a neighbor as unassigned only prevents a trim, so
+    // racing with concurrent assignments is safe.
+    auto trim = [&](int maxRounds)
+    {
+        for (int round = 0; round < maxRounds; round++)
+        {
+            atomic<int> trimmed{0};
+            runOnThreads(numThreads, [&](int t)
+                         {
+                auto [begin, end] = range(t, n);
+                int local = 0;
+                for (int v = begin; v < end; v++)
+                {
+                    if (comp[v].load(memory_order_relaxed) != -1)
+                    {
+                        continue;
+                    }
+                    bool hasIn = false, hasOut = false;
+                    for (int i = g.inOffsets[v]; i < g.inOffsets[v + 1] && !hasIn; i++)
+                    {
+                        int u = g.sources[i];
+                        hasIn = u != v && comp[u].load(memory_order_relaxed) == -1;
+                    }
+                    for (int i = g.offsets[v]; i < g.offsets[v + 1] && hasIn && !hasOut; i++)
+                    {
+                        int w = g.targets[i];
+                        hasOut = w != v && comp[w].load(memory_order_relaxed) == -1;
+                    }
+                    if (!hasIn || !hasOut)
+                    {
+                        comp[v].store(nextId.fetch_add(1, memory_order_relaxed), memory_order_relaxed);
+                        local++;
+                    }
+                }
+                trimmed += local; });
+
+            if (trimmed == 0)
+            {
+                break;
+            }
+        }
+    };
+
+    trim(8);
+
+    // Phase 2: forward-backward search from the best remaining pivot
+    vector<long long> bestScore(numThreads, -1);
+    vector<int> bestVertex(numThreads, -1);
+    runOnThreads(numThreads, [&](int t)
+                 {
+        auto [begin, end] = range(t, n);
+        for (int v = begin; v < end; v++)
+        {
+            long long score = static_cast<long long>(g.offsets[v + 1] - g.offsets[v]) * (g.inOffsets[v + 1] - g.inOffsets[v]);
+            if (comp[v].load(memory_order_relaxed) == -1 && score > bestScore[t])
+            {
+                bestScore[t] = score;
+                bestVertex[t] = v;
+            }
+        } });
+    int pivot = bestVertex[max_element(bestScore.begin(), bestScore.end()) - bestScore.begin()];
+
+    if (pivot != -1)
+    {
+        vector<atomic<unsigned char>> reached(n); // bit 0: forward, bit 1: backward
+        runOnThreads(numThreads, [&](int t)
+                     {
+            auto [begin, end] = range(t, n);
+            for (int v = begin; v < end; v++)
+            {
+                reached[v].store(0, memory_order_relaxed);
+            } });
+
+        auto search = [&](unsigned char bit, const vector<int> &offsets, const vector<int> &adjacent)
+        {
+            vector<int> frontier = {pivot};
+            reached[pivot].fetch_or(bit, memory_order_relaxed);
+            vector<vector<int>> next(numThreads);
+
+            while (!frontier.empty())
+            {
+                runOnThreads(numThreads, [&](int t)
+                             {
+                    next[t].clear();
+                    auto [begin, end] = range(t, frontier.size());
+                    for (int i = begin; i < end; i++)
+                    {
+                        int u = frontier[i];
+                        for (int e = offsets[u]; e < offsets[u + 1]; e++)
+                        {
+                            int w = adjacent[e];
+                            if (comp[w].load(memory_order_relaxed) == -1 &&
+                                !(reached[w].load(memory_order_relaxed) & bit) &&
+                                !(reached[w].fetch_or(bit, memory_order_relaxed) & bit))
+                            {
+                                next[t].push_back(w);
+                            }
+                        }
+                    } });
+
+                frontier.clear();
+                for (const auto &local : next)
+                {
+                    frontier.insert(frontier.end(), local.begin(), local.end());
+                }
+            }
+        };
+
+        search(1, g.offsets, g.targets);
+        search(2, g.inOffsets, g.sources);
+
+        int pivotId = nextId.fetch_add(1, memory_order_relaxed);
+        runOnThreads(numThreads, [&](int t)
+                     {
+            auto [begin, end] = range(t, n);
+            for (int v = begin; v < end; v++)
+            {
+                if (reached[v].load(memory_order_relaxed) == 3)
+                {
+                    comp[v].store(pivotId, memory_order_relaxed);
+                }
+            } });
+
+        trim(8);
+    }
+
+    // Phase 4: weakly connected components of what is left, then Tarjan per component
+    ConcurrentUnionFind wcc(n);
+    runOnThreads(numThreads, [&](int t)
+                 {
+        auto [begin, end] = range(t, n);
+        for (int u = begin; u < end; u++)
+        {
+            if (comp[u].load(memory_order_relaxed) != -1)
+            {
+                continue;
+            }
+            for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++)
+            {
+                int w = g.targets[e];
+                if (comp[w].load(memory_order_relaxed) == -1)
+                {
+                    wcc.unite(u, w);
+                }
+            }
+        } });
+
+    // Group the remaining vertices by component root (counting sort)
+    vector<int> root(n, -1);
+    vector<int> groupStart(n + 1, 0);
+    for (int v = 0; v < n; v++)
+    {
+        if (comp[v].load(memory_order_relaxed) == -1)
+        {
+            root[v] = wcc.find(v);
+            groupStart[root[v] + 1]++;
+        }
+    }
+    for (int v = 0; v < n; v++)
+    {
+        groupStart[v + 1] += groupStart[v];
+    }
+    vector<int> members(groupStart[n]);
+    vector<int> fillPos(groupStart.begin(), groupStart.end() - 1);
+    vector<int> groups;
+    for (int v = 0; v < n; v++)
+    {
+        if (root[v] != -1)
+        {
+            if (fillPos[root[v]] == groupStart[root[v]])
+            {
+                groups.push_back(root[v]);
+            }
+            members[fillPos[root[v]]++] = v;
+        }
+    }
+    sort(groups.begin(), groups.end(), [&](int a, int b)
+         { return groupStart[a + 1] - groupStart[a] > groupStart[b + 1] - groupStart[b]; });
+
+    sccId.assign(n, -1);
+    vector<int> disc(n, -1), low(n, 0);
+    vector<char> onStack(n, 0);
+    atomic<size_t> nextGroup{0};
+
+    runOnThreads(numThreads, [&](int)
+                 {
+        vector<int> scope;
+        while (true)
+        {
+            size_t index = nextGroup.fetch_add(1);
+            if (index >= groups.size())
+            {
+                break;
+            }
+            int group = groups[index];
+            scope.assign(members.begin() + groupStart[group], members.begin() + groupStart[group + 1]);
+            tarjanScoped(
+                g, scope, [&](int v)
+                { return root[v] == group; },
+                [&]()
+                { return nextId.fetch_add(1, memory_order_relaxed); },
+                disc, low, onStack, sccId);
+        } });
+
+    for (int v = 0; v < n; v++)
+    {
+        if (sccId[v] == -1)
+        {
+            sccId[v] = comp[v].load(memory_order_relaxed);
+        }
+    }
+
+    return nextId.load();
+}
+
+/**
+ * Condensation DAG in CSR form: one node per SCC, one edge per pair of SCCs that
+ * are joined by at least one original edge
+ */
+struct CondensationDAG
+{
+    int numComponents = 0;
+    vector<int> componentOf; // SCC id of every original vertex
+    vector<int> offsets;     // numComponents + 1 row starts into targets
+    vector<int> targets;     // Successor components, ascending within each row
+    vector<int> memberStart; // numComponents + 1 row starts into members
+    vector<int> members;     // Original vertices grouped by component
+};
+
+/**
+ * Build the condensation DAG directly into CSR arrays
+ *
+ * Vertices are grouped by component with a counting sort. Each component's
+ * successors are then deduplicated with a "last seen by" stamp per component
+ * instead of a std::set, so the whole build is O(V + E) plus sorting each row.
+ *
+ * @param g Graph
+ * @param sccId SCC id of every vertex (0..numComponents-1)
+ * @param numComponents Number of SCCs
+ */
+CondensationDAG buildCondensation(const CSRDigraph &g, const vector<int> &sccId, int numComponents)
+{
+    CondensationDAG dag;
+    dag.numComponents = numComponents;
+    dag.componentOf = sccId;
+
+    dag.memberStart.assign(numComponents + 1, 0);
+    for (int v = 0; v < g.V; v++)
+    {
+        dag.memberStart[sccId[v] + 1]++;
+    }
+    for (int c = 0; c < numComponents; c++)
+    {
+        dag.memberStart[c + 1] += dag.memberStart[c];
+    }
+    dag.members.resize(g.V);
+    vector<int> fillPos(dag.memberStart.begin(), dag.memberStart.end() - 1);
+    for (int v = 0; v < g.V; v++)
+    {
+        dag.members[fillPos[sccId[v]]++] = v;
+    }
+
+    vector<int> lastSeen(numComponents, -1);
+    dag.offsets.assign(numComponents + 1, 0);
+    for (int c = 0; c < numComponents; c++)
+    {
+        int rowStart = dag.targets.size();
+        for (int i = dag.memberStart[c]; i < dag.memberStart[c + 1]; i++)
+        {
+            int v = dag.members[i];
+            for (int e = g.offsets[v]; e < g.offsets[v + 1]; e++)
+            {
+                int d = sccId[g.targets[e]];
+                if (d != c && lastSeen[d] != c)
+                {
+                    lastSeen[d] = c;
+                    dag.targets.push_back(d);
+                }
+            }
+        }
+        sort(dag.targets.begin() + rowStart, dag.targets.end());
+        dag.offsets[c + 1] = dag.targets.size();
+    }
+
+    return dag;
+}
+
 // ===================================================
 // 2. ARTICULATION POINTS AND BRIDGES
 // ===================================================
@@ -513,104 +1133,482 @@ public:
         vector<bool> visited(V, false);
         set<int> artPoints;
 
-        // Call the recursive helper function for all vertices
-        for (int i = 0; i < V; i++)
-        {
-            if (!visited[i])
+        // Call the recursive helper function for all vertices
+        for (int i = 0; i < V; i++)
+        {
+            if (!visited[i])
+            {
+                APUtil(i, visited, disc, low, parent, artPoints);
+            }
+        }
+
+        return artPoints;
+    }
+
+    // Find all bridges
+    vector<pair<int, int>> findBridges()
+    {
+        vector<int> disc(V, -1);
+        vector<int> low(V, -1);
+        vector<int> parent(V, -1);
+        vector<bool> visited(V, false);
+        vector<pair<int, int>> bridges;
+
+        // Call the recursive helper function for all vertices
+        for (int i = 0; i < V; i++)
+        {
+            if (!visited[i])
+            {
+                bridgeUtil(i, visited, disc, low, parent, bridges);
+            }
+        }
+
+        return bridges;
+    }
+
+    // Find all biconnected components
+    vector<vector<int>> findBiconnectedComponents()
+    {
+        vector<int> disc(V, -1);
+        vector<int> low(V, -1);
+        stack<pair<int, int>> st;
+        vector<vector<int>> BCCs;
+
+        // Call the recursive helper function for all vertices
+        for (int i = 0; i < V; i++)
+        {
+            if (disc[i] == -1)
+            {
+                BCCUtil(i, disc, low, st, BCCs);
+
+                // If stack is not empty, then one more BCC exists
+                vector<int> component;
+                set<int> vertices;
+
+                while (!st.empty())
+                {
+                    vertices.insert(st.top().first);
+                    vertices.insert(st.top().second);
+                    st.pop();
+                }
+
+                if (!vertices.empty())
+                {
+                    component.assign(vertices.begin(), vertices.end());
+                    BCCs.push_back(component);
+                }
+            }
+        }
+
+        return BCCs;
+    }
+
+    // Check if removing a vertex would disconnect the graph
+    bool isArticulationPoint(int vertex)
+    {
+        set<int> artPoints = findArticulationPoints();
+        return artPoints.find(vertex) != artPoints.end();
+    }
+
+    // Check if removing an edge would disconnect the graph
+    bool isBridge(int u, int v)
+    {
+        vector<pair<int, int>> bridges = findBridges();
+        return find(bridges.begin(), bridges.end(), make_pair(u, v)) != bridges.end() ||
+               find(bridges.begin(), bridges.end(), make_pair(v, u)) != bridges.end();
+    }
+
+    // Return the resilience score (higher is better)
+    // Defined as: 1 - (num_articulation_points / num_vertices)
+    double getResilienceScore()
+    {
+        set<int> artPoints = findArticulationPoints();
+        return 1.0 - (double)artPoints.size() / V;
+    }
+};
+
+// ===================================================
+// 3. FLOW NETWORKS
+// ===================================================
+
+/**
+ * Highest-label push-relabel maximum flow on a compact arc array
+ *
+ * Every edge becomes two arcs stored in CSR order (the arcs leaving a vertex are
+ * contiguous), and each arc knows the index of its paired reverse arc. Active
+ * vertices sit in buckets by height and the highest one is discharged first.
+ * Two heuristics keep the number of relabels low:
+ * - Global relabel: every so often, reset all heights to the exact residual
+ *   distance to the sink with a backward BFS (optionally on several threads)
+ * - Gap: when a height becomes empty, every vertex above it is cut off from the
+ *   sink and is lifted out of the way at once
+ *
+ * Phase 1 computes a maximum preflow, which already gives the flow value. Phase 2
+ * returns the leftover excess to the source, so the final arcs hold a valid flow.
+ *
+ * Time Complexity: O(V^2 * sqrt(E)) worst case, close to linear on typical networks
+ * Space Complexity: O(V + E)
+ */
+class PushRelabelMaxFlow
+{
+private:
+    // A relabel costs its vertex degree plus this constant in the work estimate
+    static const int RELABEL_WORK = 12;
+    // Global relabel once the work since the last one exceeds this many times V (+ E/2)
+    static const int GLOBAL_RELABEL_FACTOR = 6;
+
+    int V;
+    vector<int> edgeFrom, edgeTo, edgeCap; // Edges in the order they were added
+
+    // Residual network in CSR form
+    vector<int> arcStart;   // V + 1 entries
+    vector<int> arcHead;    // Target vertex of each arc
+    vector<int> arcReverse; // Index of the paired reverse arc
+    vector<int> residual;   // Residual capacity of each arc
+    vector<int> forwardArc; // Arc of each added edge
+
+    vector<int> height;
+    vector<long long> excess;
+    vector<int> currentArc;
+
+    // Buckets by height: active vertices (singly linked) and all vertices (doubly linked)
+    vector<int> activeHead, nextActive;
+    vector<int> allHead, allNext, allPrev;
+    int maxActive = -1; // No active vertex above this height
+    int maxHeight = -1; // No vertex below V above this height
+
+    bool parallelRelabel = false;
+    int numThreads = 1;
+    long long work = 0;
+
+    void buildArcs()
+    {
+        int E = edgeFrom.size();
+        arcStart.assign(V + 1, 0);
+        for (int i = 0; i < E; i++)
+        {
+            arcStart[edgeFrom[i] + 1]++;
+            arcStart[edgeTo[i] + 1]++;
+        }
+        for (int v = 0; v < V; v++)
+        {
+            arcStart[v + 1] += arcStart[v];
+        }
+
+        arcHead.resize(2 * E);
+        arcReverse.resize(2 * E);
+        residual.resize(2 * E);
+        forwardArc.resize(E);
+        vector<int> pos(arcStart.begin(), arcStart.end() - 1);
+        for (int i = 0; i < E; i++)
+        {
+            int a = pos[edgeFrom[i]]++;
+            int b = pos[edgeTo[i]]++;
+            arcHead[a] = edgeTo[i];
+            arcHead[b] = edgeFrom[i];
+            arcReverse[a] = b;
+            arcReverse[b] = a;
+            residual[a] = edgeCap[i];
+            residual[b] = 0;
+            forwardArc[i] = a;
+        }
+    }
+
+    void addToAll(int v)
+    {
+        int h = height[v];
+        allPrev[v] = -1;
+        allNext[v] = allHead[h];
+        if (allHead[h] != -1)
+        {
+            allPrev[allHead[h]] = v;
+        }
+        allHead[h] = v;
+        maxHeight = max(maxHeight, h);
+    }
+
+    void removeFromAll(int v)
+    {
+        if (allPrev[v] != -1)
+        {
+            allNext[allPrev[v]] = allNext[v];
+        }
+        else
+        {
+            allHead[height[v]] = allNext[v];
+        }
+        if (allNext[v] != -1)
+        {
+            allPrev[allNext[v]] = allPrev[v];
+        }
+    }
+
+    void activate(int v)
+    {
+        nextActive[v] = activeHead[height[v]];
+        activeHead[height[v]] = v;
+        maxActive = max(maxActive, height[v]);
+    }
+
+    // Backward BFS from target over residual arcs; excluded keeps height V
+    void globalRelabel(int target, int excluded)
+    {
+        height.assign(V, V);
+        height[target] = 0;
+        vector<int> frontier = {target};
+
+        if (!parallelRelabel || numThreads <= 1)
+        {
+            for (size_t i = 0; i < frontier.size(); i++)
+            {
+                int v = frontier[i];
+                for (int a = arcStart[v]; a < arcStart[v + 1]; a++)
+                {
+                    int u = arcHead[a];
+                    if (height[u] == V && u != excluded && residual[arcReverse[a]] > 0)
+                    {
+                        height[u] = height[v] + 1;
+                        frontier.push_back(u);
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Level-synchronous BFS: threads split the frontier and claim vertices by CAS
+            vector<atomic<int>> label(V);
+            runOnThreads(numThreads, [&](int t)
+                         {
+                for (int v = V * (long long)t / numThreads; v < V * (long long)(t + 1) / numThreads; v++)
+                {
+                    label[v].store(v == target || v == excluded ? 0 : V, memory_order_relaxed);
+                } });
+
+            vector<vector<int>> next(numThreads);
+            for (int level = 1; !frontier.empty(); level++)
+            {
+                runOnThreads(numThreads, [&](int t)
+                             {
+                    next[t].clear();
+                    size_t begin = frontier.size() * t / numThreads;
+                    size_t end = frontier.size() * (t + 1) / numThreads;
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        int v = frontier[i];
+                        for (int a = arcStart[v]; a < arcStart[v + 1]; a++)
+                        {
+                            int u = arcHead[a];
+                            int unvisited = V;
+                            if (residual[arcReverse[a]] > 0 && label[u].load(memory_order_relaxed) == V &&
+                                label[u].compare_exchange_strong(unvisited, level, memory_order_relaxed))
+                            {
+                                next[t].push_back(u);
+                            }
+                        }
+                    } });
+
+                frontier.clear();
+                for (const auto &local : next)
+                {
+                    frontier.insert(frontier.end(), local.begin(), local.end());
+                }
+            }
+
+            for (int v = 0; v < V; v++)
             {
-                APUtil(i, visited, disc, low, parent, artPoints);
+                if (v != target && v != excluded)
+                {
+                    height[v] = label[v].load(memory_order_relaxed);
+                }
             }
         }
 
-        return artPoints;
-    }
-
-    // Find all bridges
-    vector<pair<int, int>> findBridges()
-    {
-        vector<int> disc(V, -1);
-        vector<int> low(V, -1);
-        vector<int> parent(V, -1);
-        vector<bool> visited(V, false);
-        vector<pair<int, int>> bridges;
-
-        // Call the recursive helper function for all vertices
-        for (int i = 0; i < V; i++)
+        // Rebuild the buckets from the new heights
+        activeHead.assign(V + 1, -1);
+        allHead.assign(V + 1, -1);
+        maxActive = maxHeight = -1;
+        for (int v = 0; v < V; v++)
         {
-            if (!visited[i])
+            currentArc[v] = arcStart[v];
+            if (height[v] < V)
             {
-                bridgeUtil(i, visited, disc, low, parent, bridges);
+                addToAll(v);
+                if (excess[v] > 0 && v != target)
+                {
+                    activate(v);
+                }
             }
         }
-
-        return bridges;
+        work = 0;
     }
 
-    // Find all biconnected components
-    vector<vector<int>> findBiconnectedComponents()
+    // Push excess out of u until it is gone or u is lifted to height V
+    void discharge(int u, int target)
     {
-        vector<int> disc(V, -1);
-        vector<int> low(V, -1);
-        stack<pair<int, int>> st;
-        vector<vector<int>> BCCs;
-
-        // Call the recursive helper function for all vertices
-        for (int i = 0; i < V; i++)
+        while (excess[u] > 0)
         {
-            if (disc[i] == -1)
+            int h = height[u];
+            int end = arcStart[u + 1];
+            int a = currentArc[u];
+            for (; a < end; a++)
             {
-                BCCUtil(i, disc, low, st, BCCs);
+                int v = arcHead[a];
+                if (residual[a] > 0 && height[v] == h - 1)
+                {
+                    long long delta = min<long long>(excess[u], residual[a]);
+                    if (excess[v] == 0 && v != target)
+                    {
+                        activate(v);
+                    }
+                    residual[a] -= delta;
+                    residual[arcReverse[a]] += delta;
+                    excess[u] -= delta;
+                    excess[v] += delta;
+                    if (excess[u] == 0)
+                    {
+                        break;
+                    }
+                }
+            }
+            currentArc[u] = a;
+            if (excess[u] == 0)
+            {
+                return;
+            }
 
-                // If stack is not empty, then one more BCC exists
-                vector<int> component;
-                set<int> vertices;
+            work += end - arcStart[u] + RELABEL_WORK;
 
-                while (!st.empty())
+            // Gap: u is the last vertex at height h, so nothing above h can reach the target
+            if (allHead[h] == u && allNext[u] == -1)
+            {
+                for (int g = h; g <= maxHeight; g++)
                 {
-                    vertices.insert(st.top().first);
-                    vertices.insert(st.top().second);
-                    st.pop();
+                    for (int v = allHead[g]; v != -1; v = allNext[v])
+                    {
+                        height[v] = V;
+                    }
+                    allHead[g] = -1;
                 }
+                maxHeight = h - 1;
+                return;
+            }
 
-                if (!vertices.empty())
+            // Relabel: one above the lowest residual neighbor
+            int newHeight = V;
+            for (int b = arcStart[u]; b < end; b++)
+            {
+                if (residual[b] > 0 && height[arcHead[b]] + 1 < newHeight)
                 {
-                    component.assign(vertices.begin(), vertices.end());
-                    BCCs.push_back(component);
+                    newHeight = height[arcHead[b]] + 1;
+                    currentArc[u] = b;
                 }
             }
+            removeFromAll(u);
+            height[u] = newHeight;
+            if (newHeight >= V)
+            {
+                return;
+            }
+            addToAll(u);
         }
+    }
 
-        return BCCs;
+    // Discharge active vertices highest first until none is left
+    void run(int target, int excluded)
+    {
+        long long relabelThreshold = (long long)GLOBAL_RELABEL_FACTOR * V + (long long)arcHead.size() / 2;
+        globalRelabel(target, excluded);
+
+        while (true)
+        {
+            while (maxActive >= 0 && activeHead[maxActive] == -1)
+            {
+                maxActive--;
+            }
+            if (maxActive < 0)
+            {
+                break;
+            }
+
+            int u = activeHead[maxActive];
+            activeHead[maxActive] = nextActive[u];
+            discharge(u, target);
+
+            if (work > relabelThreshold)
+            {
+                globalRelabel(target, excluded);
+            }
+        }
     }
 
-    // Check if removing a vertex would disconnect the graph
-    bool isArticulationPoint(int vertex)
+public:
+    // Constructor
+    PushRelabelMaxFlow(int vertices) : V(vertices) {}
+
+    // Add a directed edge with given capacity; returns the edge index
+    int addEdge(int u, int v, int cap)
     {
-        set<int> artPoints = findArticulationPoints();
-        return artPoints.find(vertex) != artPoints.end();
+        edgeFrom.push_back(u);
+        edgeTo.push_back(v);
+        edgeCap.push_back(cap);
+        return edgeFrom.size() - 1;
     }
 
-    // Check if removing an edge would disconnect the graph
-    bool isBridge(int u, int v)
+    /**
+     * Compute a maximum flow from source to sink (starting from zero flow)
+     *
+     * @param source Source vertex
+     * @param sink Sink vertex
+     * @param parallelGlobalRelabel Run the global-relabel BFS on several threads
+     * @param threads Number of threads for the BFS (0 = hardware concurrency)
+     * @return Value of the maximum flow
+     */
+    long long maxFlow(int source, int sink, bool parallelGlobalRelabel = false, int threads = 0)
     {
-        vector<pair<int, int>> bridges = findBridges();
-        return find(bridges.begin(), bridges.end(), make_pair(u, v)) != bridges.end() ||
-               find(bridges.begin(), bridges.end(), make_pair(v, u)) != bridges.end();
+        parallelRelabel = parallelGlobalRelabel;
+        numThreads = threads > 0 ? threads : max(1u, thread::hardware_concurrency());
+
+        buildArcs();
+        excess.assign(V, 0);
+        currentArc.assign(V, 0);
+        nextActive.assign(V, -1);
+        allNext.assign(V, -1);
+        allPrev.assign(V, -1);
+        if (source == sink)
+        {
+            return 0;
+        }
+
+        // Saturate every arc out of the source
+        for (int a = arcStart[source]; a < arcStart[source + 1]; a++)
+        {
+            int v = arcHead[a];
+            if (v != source && residual[a] > 0)
+            {
+                excess[v] += residual[a];
+                excess[source] -= residual[a];
+                residual[arcReverse[a]] += residual[a];
+                residual[a] = 0;
+            }
+        }
+
+        // Phase 1: maximum preflow towards the sink
+        run(sink, source);
+        long long flowValue = excess[sink];
+
+        // Phase 2: send the remaining excess back to the source
+        run(source, sink);
+
+        return flowValue;
     }
 
-    // Return the resilience score (higher is better)
-    // Defined as: 1 - (num_articulation_points / num_vertices)
-    double getResilienceScore()
+    // Flow on an edge after maxFlow
+    int getFlow(int edgeIndex) const
     {
-        set<int> artPoints = findArticulationPoints();
-        return 1.0 - (double)artPoints.size() / V;
+        return edgeCap[edgeIndex] - residual[forwardArc[edgeIndex]];
     }
 };
 
-// ===================================================
-// 3. FLOW NETWORKS
-// ===================================================
-
 /**
  * FlowNetwork class for maximum flow algorithms
  */
@@ -838,6 +1836,42 @@ public:
         return maxFlow;
     }
 
+    // Push-relabel maximum flow on a compact arc copy of the network.
+    // The result is written back into the flow matrix, so getMinCutEdges works afterwards.
+    int pushRelabel(int source, int sink, bool parallelGlobalRelabel = false)
+    {
+        PushRelabelMaxFlow solver(V);
+        for (int u = 0; u < V; u++)
+        {
+            for (int v = 0; v < V; v++)
+            {
+                if (capacity[u][v] > 0)
+                {
+                    solver.addEdge(u, v, capacity[u][v]);
+                }
+            }
+        }
+
+        int maxFlow = solver.maxFlow(source, sink, parallelGlobalRelabel);
+
+        resetFlow();
+        int edge = 0;
+        for (int u = 0; u < V; u++)
+        {
+            for (int v = 0; v < V; v++)
+            {
+                if (capacity[u][v] > 0)
+                {
+                    int f = solver.getFlow(edge++);
+                    flow[u][v] += f;
+                    flow[v][u] -= f;
+                }
+            }
+        }
+
+        return maxFlow;
+    }
+
     // Find the min-cut edges
     vector<pair<int, int>> getMinCutEdges(int source)
     {
@@ -963,6 +1997,311 @@ double timeFunction(Func func)
     return chrono::duration_cast<chrono::microseconds>(end - start).count() / 1000.0;
 }
 
+/**
+ * Benchmark the SCC implementations on a random dependency-like graph
+ *
+ * Most edges point from a lower to a higher vertex id (acyclic, like dependencies);
+ * the rest are random and create cycles of all sizes. All results are checked
+ * against the CSR Tarjan partition.
+ *
+ * @param numVertices Number of vertices
+ * @param numEdges Number of edges
+ * @param numThreads Number of threads for parallelSCC (0 = hardware concurrency)
+ */
+void benchmarkSCC(int numVertices, long long numEdges, int numThreads = 0)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = max(1u, thread::hardware_concurrency());
+    }
+
+    cout << "\n===== SCC BENCHMARK =====" << endl;
+    cout << "Vertices: " << numVertices << ", Edges: " << numEdges << ", Threads: " << numThreads << endl;
+
+    mt19937_64 gen(34);
+    uniform_int_distribution<int> vertexDist(0, numVertices - 1);
+    vector<pair<int, int>> edges;
+    edges.reserve(numEdges);
+    for (long long i = 0; i < numEdges; i++)
+    {
+        int u = vertexDist(gen), v = vertexDist(gen);
+        if (i % 10 != 0 && u > v)
+        {
+            swap(u, v);
+        }
+        edges.push_back({u, v});
+    }
+
+    DirectedGraph graph(numVertices);
+    for (const auto &[u, v] : edges)
+    {
+        graph.addEdge(u, v);
+    }
+    CSRDigraph csr(numVertices, edges);
+
+    // Two labelings describe the same partition if the label mapping is one-to-one
+    vector<int> reference;
+    int referenceCount = 0;
+    double tarjanCSRTime = timeFunction([&]
+                                        { referenceCount = tarjanSCC(csr, reference); });
+
+    auto samePartition = [&](const vector<int> &labels, int count)
+    {
+        if (count != referenceCount)
+        {
+            return false;
+        }
+        vector<int> forward(count, -1), backward(referenceCount, -1);
+        for (int v = 0; v < numVertices; v++)
+        {
+            int a = reference[v], b = labels[v];
+            if ((forward[b] != -1 && forward[b] != a) || (backward[a] != -1 && backward[a] != b))
+            {
+                return false;
+            }
+            forward[b] = a;
+            backward[a] = b;
+        }
+        return true;
+    };
+
+    auto toLabels = [&](const vector<vector<int>> &components)
+    {
+        vector<int> labels(numVertices, -1);
+        for (size_t c = 0; c < components.size(); c++)
+        {
+            for (int v : components[c])
+            {
+                labels[v] = c;
+            }
+        }
+        return labels;
+    };
+
+    cout << left << setw(35) << "Algorithm" << setw(15) << "Time (ms)"
+         << setw(12) << "SCCs" << setw(12) << "Same Result" << endl;
+    cout << string(74, '-') << endl;
+
+    auto report = [&](const string &name, double time, int count, bool same)
+    {
+        cout << left << setw(35) << name << setw(15) << fixed << setprecision(2) << time
+             << setw(12) << count << setw(12) << (same ? "Yes" : "No") << endl;
+    };
+
+    vector<vector<int>> components;
+    double time = timeFunction([&]
+                               { components = graph.kosarajuSCC(); });
+    report("Kosaraju (DirectedGraph)", time, components.size(), samePartition(toLabels(components), components.size()));
+
+    time = timeFunction([&]
+                        { components = graph.tarjanSCC(); });
+    report("Tarjan (DirectedGraph)", time, components.size(), samePartition(toLabels(components), components.size()));
+
+    report("Tarjan (CSR)", tarjanCSRTime, referenceCount, true);
+
+    vector<int> labels;
+    int count = 0;
+    time = timeFunction([&]
+                        { count = parallelSCC(csr, labels, 1); });
+    report("Parallel FW-BW-Trim (1 thread)", time, count, samePartition(labels, count));
+
+    if (numThreads > 1)
+    {
+        time = timeFunction([&]
+                            { count = parallelSCC(csr, labels, numThreads); });
+        report("Parallel FW-BW-Trim (" + to_string(numThreads) + " threads)", time, count, samePartition(labels, count));
+    }
+
+    // Condensation: std::set rebuild vs CSR build
+    int setEdges = 0;
+    time = timeFunction([&]
+                        {
+        auto condensed = graph.getCondensationGraph();
+        setEdges = condensed.first.getEdgeCount(); });
+    cout << "\nCondensation via std::set: " << fixed << setprecision(2) << time << " ms, "
+         << setEdges << " edges" << endl;
+
+    CondensationDAG dag;
+    time = timeFunction([&]
+                        { dag = buildCondensation(csr, reference, referenceCount); });
+    cout << "Condensation as CSR:       " << fixed << setprecision(2) << time << " ms, "
+         << dag.targets.size() << " edges (" << (dag.targets.size() == static_cast<size_t>(setEdges) ? "same" : "different")
+         << ")" << endl;
+}
+
+// A generated max-flow instance
+struct FlowInstance
+{
+    string name;
+    int numVertices;
+    int source;
+    int sink;
+    vector<array<int, 3>> edges; // (from, to, capacity), no duplicate pairs
+};
+
+// Source -> layer 0 -> ... -> layer L-1 -> sink, each vertex linked to `degree` vertices of the next layer
+FlowInstance makeLayeredNetwork(int layers, int width, int degree, mt19937 &gen)
+{
+    FlowInstance inst{"Layered", layers * width + 2, layers * width, layers * width + 1, {}};
+    uniform_int_distribution<int> capDist(1, 100), startDist(0, width - 1);
+    for (int i = 0; i < width; i++)
+    {
+        inst.edges.push_back({inst.source, i, capDist(gen)});
+        inst.edges.push_back({(layers - 1) * width + i, inst.sink, capDist(gen)});
+    }
+    for (int l = 0; l + 1 < layers; l++)
+    {
+        for (int i = 0; i < width; i++)
+        {
+            int start = startDist(gen);
+            for (int k = 0; k < min(degree, width); k++)
+            {
+                inst.edges.push_back({l * width + i, (l + 1) * width + (start + k) % width, capDist(gen)});
+            }
+        }
+    }
+    return inst;
+}
+
+// rows x cols grid with edges in all four directions; source feeds the left column, sink drains the right column
+FlowInstance makeGridNetwork(int rows, int cols, mt19937 &gen)
+{
+    FlowInstance inst{"Grid", rows * cols + 2, rows * cols, rows * cols + 1, {}};
+    uniform_int_distribution<int> capDist(1, 100);
+    for (int r = 0; r < rows; r++)
+    {
+        inst.edges.push_back({inst.source, r * cols, capDist(gen) * 10});
+        inst.edges.push_back({r * cols + cols - 1, inst.sink, capDist(gen) * 10});
+        for (int c = 0; c < cols; c++)
+        {
+            int v = r * cols + c;
+            if (c + 1 < cols)
+            {
+                inst.edges.push_back({v, v + 1, capDist(gen)});
+                inst.edges.push_back({v + 1, v, capDist(gen)});
+            }
+            if (r + 1 < rows)
+            {
+                inst.edges.push_back({v, v + cols, capDist(gen)});
+                inst.edges.push_back({v + cols, v, capDist(gen)});
+            }
+        }
+    }
+    return inst;
+}
+
+// Source -> left (supply), left -> `degree` random right vertices, right -> sink (demand)
+FlowInstance makeBipartiteNetwork(int left, int right, int degree, mt19937 &gen)
+{
+    FlowInstance inst{"Random bipartite", left + right + 2, left + right, left + right + 1, {}};
+    uniform_int_distribution<int> capDist(1, 10), startDist(0, right - 1), stepDist(1, max(1, right / max(1, degree)));
+    for (int i = 0; i < left; i++)
+    {
+        inst.edges.push_back({inst.source, i, capDist(gen)});
+        int start = startDist(gen), step = stepDist(gen);
+        for (int k = 0; k < min(degree, right); k++)
+        {
+            inst.edges.push_back({i, left + (start + k * step) % right, capDist(gen)});
+        }
+    }
+    for (int j = 0; j < right; j++)
+    {
+        inst.edges.push_back({left + j, inst.sink, capDist(gen)});
+    }
+    return inst;
+}
+
+/**
+ * Benchmark max-flow implementations on layered, grid and random bipartite networks
+ *
+ * The adjacency-matrix Dinic needs V^2 memory, so it only runs on small instances.
+ *
+ * @param numVertices Approximate number of vertices per instance
+ * @param numThreads Threads for the parallel global relabel (0 = hardware concurrency)
+ */
+void benchmarkMaxFlow(int numVertices, int numThreads = 0)
+{
+    if (numThreads <= 0)
+    {
+        numThreads = max(1u, thread::hardware_concurrency());
+    }
+    const int MATRIX_LIMIT = 5000;
+
+    cout << "\n===== MAX FLOW BENCHMARK (~" << numVertices << " vertices) =====" << endl;
+
+    mt19937 gen(35);
+    // Push-relabel needs about V^1.5 discharges on grids, so the grid gets a quarter of the vertices
+    int side = max(2, (int)sqrt(numVertices / 4.0));
+    vector<FlowInstance> instances = {
+        makeLayeredNetwork(max(2, numVertices / 1000), min(1000, numVertices), 4, gen),
+        makeGridNetwork(side, side, gen),
+        makeBipartiteNetwork(numVertices / 2, numVertices / 2, 4, gen)};
+
+    cout << left << setw(20) << "Network" << setw(12) << "Edges" << setw(40) << "Algorithm"
+         << setw(15) << "Time (ms)" << setw(15) << "Max Flow" << setw(12) << "Same Result" << endl;
+    cout << string(114, '-') << endl;
+
+    for (const auto &inst : instances)
+    {
+        auto report = [&](const string &algorithm, double time, long long value, bool same)
+        {
+            cout << left << setw(20) << inst.name << setw(12) << inst.edges.size() << setw(40) << algorithm
+                 << setw(15) << fixed << setprecision(2) << time << setw(15) << value
+                 << setw(12) << (same ? "Yes" : "No") << endl;
+        };
+
+        long long reference = 0;
+        double time = timeFunction([&]
+                                   {
+            PushRelabelMaxFlow solver(inst.numVertices);
+            for (const auto &e : inst.edges)
+            {
+                solver.addEdge(e[0], e[1], e[2]);
+            }
+            reference = solver.maxFlow(inst.source, inst.sink); });
+        report("Push-relabel", time, reference, true);
+
+        long long value = 0;
+        time = timeFunction([&]
+                            {
+            PushRelabelMaxFlow solver(inst.numVertices);
+            for (const auto &e : inst.edges)
+            {
+                solver.addEdge(e[0], e[1], e[2]);
+            }
+            value = solver.maxFlow(inst.source, inst.sink, true, numThreads); });
+        report("Push-relabel (parallel BFS, " + to_string(numThreads) + " threads)", time, value, value == reference);
+
+        if (inst.numVertices <= MATRIX_LIMIT)
+        {
+            FlowNetwork network(inst.numVertices);
+            for (const auto &e : inst.edges)
+            {
+                network.addEdge(e[0], e[1], e[2]);
+            }
+            time = timeFunction([&]
+                                { value = network.dinic(inst.source, inst.sink); });
+            report("Dinic (matrix)", time, value, value == reference);
+
+            // The push-relabel flow written into the matrix must give a cut of the same capacity
+            network.resetFlow();
+            network.pushRelabel(inst.source, inst.sink);
+            unordered_map<long long, int> edgeCapacity;
+            for (const auto &e : inst.edges)
+            {
+                edgeCapacity[(long long)e[0] * inst.numVertices + e[1]] = e[2];
+            }
+            long long cutCapacity = 0;
+            for (const auto &[u, v] : network.getMinCutEdges(inst.source))
+            {
+                cutCapacity += edgeCapacity[(long long)u * inst.numVertices + v];
+            }
+            cout << "  Min-cut capacity from push-relabel flow: " << cutCapacity
+                 << (cutCapacity == reference ? " (matches)" : " (MISMATCH)") << endl;
+        }
+    }
+}
+
 // ===================================================
 // EXAMPLES
 // ===================================================
@@ -1199,8 +2538,11 @@ void demonstrateFlowNetworks()
 // MAIN FUNCTION
 // ===================================================
 
-int main()
+// Pass --large to also run the million-vertex benchmarks
+int main(int argc, char *argv[])
 {
+    bool runLarge = argc > 1 && string(argv[1]) == "--large";
+
     cout << "=====================================================" << endl;
     cout << "DAY 34: ADVANCED GRAPH ALGORITHMS" << endl;
     cout << "=====================================================" << endl;
@@ -1210,6 +2552,20 @@ int main()
     demonstrateArticulationPointsAndBridges();
     demonstrateFlowNetworks();
 
+    // Scalability of the SCC implementations
+    benchmarkSCC(20000, 200000);
+    if (runLarge)
+    {
+        benchmarkSCC(1000000, 10000000);
+    }
+
+    // Push-relabel against the matrix Dinic, and with --large at a scale the matrix cannot hold
+    benchmarkMaxFlow(2000);
+    if (runLarge)
+    {
+        benchmarkMaxFlow(1000000);
+    }
+
     cout << "\n===== ASSIGNMENT FOR DAY 34 =====" << endl;
     cout << "1. Implement Tarjan's algorithm for finding strongly connected components" << endl;
     cout << "2. Find articulation points in a social network" << endl;
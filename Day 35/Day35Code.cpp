@@ -6,9 +6,13 @@
  *
  * This file contains comprehensive implementations of several graph algorithms:
  * - Ford-Fulkerson algorithm with Edmonds-Karp improvement for maximum flow
+ * - Highest-label push-relabel maximum flow with gap and global-relabel heuristics
+ * - Min-cost flow: SPFA paths, Dijkstra with potentials and capacity scaling, cost scaling
  * - Bipartite matching using flow networks
  * - Hungarian algorithm for assignment problems
- * - Traveling Salesman Problem (TSP) approaches
+ * - Hopcroft-Karp matching, LAPJV and parallel auction assignment for large instances
+ * - Traveling Salesman Problem (TSP) approaches, including a multithreaded SIMD Held-Karp
+ *   and neighbor-list 2-opt / Or-opt local search
  * - Benchmarking utilities for comparing algorithm performance
  *
  * These implementations are designed for educational purposes with extensive
@@ -18,6 +22,7 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <stack>
 #include <unordered_map>
 #include <unordered_set>
@@ -30,6 +35,14 @@
 #include <iomanip>
 #include <bitset>
 #include <functional>
+#include <thread>
+#include <atomic>
+#include <tuple>
+#include <cstdint>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 // Define constants
 const int INF = std::numeric_limits<int>::max();
@@ -52,6 +65,422 @@ public:
             : from(f), to(t), cap(c), flow(0), cost(co) {}
     };
 
+    /**
+     * @brief Highest-label push-relabel maximum flow on a compact arc array
+     *
+     * Every edge becomes two arcs stored in CSR order (the arcs leaving a vertex are
+     * contiguous), and each arc knows the index of its paired reverse arc. Active
+     * vertices sit in buckets by height and the highest one is discharged first.
+     * Two heuristics keep the number of relabels low:
+     * - Global relabel: every so often, reset all heights to the exact residual
+     *   distance to the sink with a backward BFS (optionally on several threads)
+     * - Gap: when a height becomes empty, every vertex above it is cut off from the
+     *   sink and is lifted out of the way at once
+     *
+     * Phase 1 computes a maximum preflow, which already gives the flow value. Phase 2
+     * returns the leftover excess to the source, so the final arcs hold a valid flow.
+     *
+     * Time complexity: O(V^2 * sqrt(E)) worst case, close to linear on typical networks
+     * Space complexity: O(V + E)
+     */
+    class PushRelabel
+    {
+    private:
+        // A relabel costs its vertex degree plus this constant in the work estimate
+        static const int RELABEL_WORK = 12;
+        // Global relabel once the work since the last one exceeds this many times V (+ E/2)
+        static const int GLOBAL_RELABEL_FACTOR = 6;
+
+        int V;
+        std::vector<int> edgeFrom, edgeTo, edgeCap, edgeReverseCap; // Edges in the order they were added
+
+        // Residual network in CSR form
+        std::vector<int> arcStart;   // V + 1 entries
+        std::vector<int> arcHead;    // Target vertex of each arc
+        std::vector<int> arcReverse; // Index of the paired reverse arc
+        std::vector<int> residual;   // Residual capacity of each arc
+        std::vector<int> forwardArc; // Arc of each added edge
+
+        std::vector<int> height;
+        std::vector<long long> excess;
+        std::vector<int> currentArc;
+
+        // Buckets by height: active vertices (singly linked) and all vertices (doubly linked)
+        std::vector<int> activeHead, nextActive;
+        std::vector<int> allHead, allNext, allPrev;
+        int maxActive = -1; // No active vertex above this height
+        int maxHeight = -1; // No vertex below V above this height
+
+        bool parallelRelabel = false;
+        int numThreads = 1;
+        long long work = 0;
+
+        // Run body(threadId) on numThreads threads (the caller acts as thread 0)
+        template <typename Body>
+        static void runOnThreads(int numThreads, Body body)
+        {
+            std::vector<std::thread> workers;
+            for (int t = 1; t < numThreads; t++)
+            {
+                workers.emplace_back(body, t);
+            }
+            body(0);
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        void buildArcs()
+        {
+            int E = edgeFrom.size();
+            arcStart.assign(V + 1, 0);
+            for (int i = 0; i < E; i++)
+            {
+                arcStart[edgeFrom[i] + 1]++;
+                arcStart[edgeTo[i] + 1]++;
+            }
+            for (int v = 0; v < V; v++)
+            {
+                arcStart[v + 1] += arcStart[v];
+            }
+
+            arcHead.resize(2 * E);
+            arcReverse.resize(2 * E);
+            residual.resize(2 * E);
+            forwardArc.resize(E);
+            std::vector<int> pos(arcStart.begin(), arcStart.end() - 1);
+            for (int i = 0; i < E; i++)
+            {
+                int a = pos[edgeFrom[i]]++;
+                int b = pos[edgeTo[i]]++;
+                arcHead[a] = edgeTo[i];
+                arcHead[b] = edgeFrom[i];
+                arcReverse[a] = b;
+                arcReverse[b] = a;
+                residual[a] = edgeCap[i];
+                residual[b] = edgeReverseCap[i];
+                forwardArc[i] = a;
+            }
+        }
+
+        void addToAll(int v)
+        {
+            int h = height[v];
+            allPrev[v] = -1;
+            allNext[v] = allHead[h];
+            if (allHead[h] != -1)
+            {
+                allPrev[allHead[h]] = v;
+            }
+            allHead[h] = v;
+            maxHeight = std::max(maxHeight, h);
+        }
+
+        void removeFromAll(int v)
+        {
+            if (allPrev[v] != -1)
+            {
+                allNext[allPrev[v]] = allNext[v];
+            }
+            else
+            {
+                allHead[height[v]] = allNext[v];
+            }
+            if (allNext[v] != -1)
+            {
+                allPrev[allNext[v]] = allPrev[v];
+            }
+        }
+
+        void activate(int v)
+        {
+            nextActive[v] = activeHead[height[v]];
+            activeHead[height[v]] = v;
+            maxActive = std::max(maxActive, height[v]);
+        }
+
+        // Backward BFS from target over residual arcs; excluded keeps height V
+        void globalRelabel(int target, int excluded)
+        {
+            height.assign(V, V);
+            height[target] = 0;
+            std::vector<int> frontier = {target};
+
+            if (!parallelRelabel || numThreads <= 1)
+            {
+                for (size_t i = 0; i < frontier.size(); i++)
+                {
+                    int v = frontier[i];
+                    for (int a = arcStart[v]; a < arcStart[v + 1]; a++)
+                    {
+                        int u = arcHead[a];
+                        if (height[u] == V && u != excluded && residual[arcReverse[a]] > 0)
+                        {
+                            height[u] = height[v] + 1;
+                            frontier.push_back(u);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // Level-synchronous BFS: threads split the frontier and claim vertices by CAS
+                std::vector<std::atomic<int>> label(V);
+                runOnThreads(numThreads, [&](int t)
+                             {
+                    for (int v = V * (long long)t / numThreads; v < V * (long long)(t + 1) / numThreads; v++)
+                    {
+                        label[v].store(v == target || v == excluded ? 0 : V, std::memory_order_relaxed);
+                    } });
+
+                std::vector<std::vector<int>> next(numThreads);
+                for (int level = 1; !frontier.empty(); level++)
+                {
+                    runOnThreads(numThreads, [&](int t)
+                                 {
+                        next[t].clear();
+                        size_t begin = frontier.size() * t / numThreads;
+                        size_t end = frontier.size() * (t + 1) / numThreads;
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            int v = frontier[i];
+                            for (int a = arcStart[v]; a < arcStart[v + 1]; a++)
+                            {
+                                int u = arcHead[a];
+                                int unvisited = V;
+                                if (residual[arcReverse[a]] > 0 && label[u].load(std::memory_order_relaxed) == V &&
+                                    label[u].compare_exchange_strong(unvisited, level, std::memory_order_relaxed))
+                                {
+                                    next[t].push_back(u);
+                                }
+                            }
+                        } });
+
+                    frontier.clear();
+                    for (const auto &local : next)
+                    {
+                        frontier.insert(frontier.end(), local.begin(), local.end());
+                    }
+                }
+
+                for (int v = 0; v < V; v++)
+                {
+                    if (v != target && v != excluded)
+                    {
+                        height[v] = label[v].load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            // Rebuild the buckets from the new heights
+            activeHead.assign(V + 1, -1);
+            allHead.assign(V + 1, -1);
+            maxActive = maxHeight = -1;
+            for (int v = 0; v < V; v++)
+            {
+                currentArc[v] = arcStart[v];
+                if (height[v] < V)
+                {
+                    addToAll(v);
+                    if (excess[v] > 0 && v != target)
+                    {
+                        activate(v);
+                    }
+                }
+            }
+            work = 0;
+        }
+
+        // Push excess out of u until it is gone or u is lifted to height V
+        void discharge(int u, int target)
+        {
+            while (excess[u] > 0)
+            {
+                int h = height[u];
+                int end = arcStart[u + 1];
+                int a = currentArc[u];
+                for (; a < end; a++)
+                {
+                    int v = arcHead[a];
+                    if (residual[a] > 0 && height[v] == h - 1)
+                    {
+                        long long delta = std::min<long long>(excess[u], residual[a]);
+                        if (excess[v] == 0 && v != target)
+                        {
+                            activate(v);
+                        }
+                        residual[a] -= delta;
+                        residual[arcReverse[a]] += delta;
+                        excess[u] -= delta;
+                        excess[v] += delta;
+                        if (excess[u] == 0)
+                        {
+                            break;
+                        }
+                    }
+                }
+                currentArc[u] = a;
+                if (excess[u] == 0)
+                {
+                    return;
+                }
+
+                work += end - arcStart[u] + RELABEL_WORK;
+
+                // Gap: u is the last vertex at height h, so nothing above h can reach the target
+                if (allHead[h] == u && allNext[u] == -1)
+                {
+                    for (int g = h; g <= maxHeight; g++)
+                    {
+                        for (int v = allHead[g]; v != -1; v = allNext[v])
+                        {
+                            height[v] = V;
+                        }
+                        allHead[g] = -1;
+                    }
+                    maxHeight = h - 1;
+                    return;
+                }
+
+                // Relabel: one above the lowest residual neighbor
+                int newHeight = V;
+                for (int b = arcStart[u]; b < end; b++)
+                {
+                    if (residual[b] > 0 && height[arcHead[b]] + 1 < newHeight)
+                    {
+                        newHeight = height[arcHead[b]] + 1;
+                        currentArc[u] = b;
+                    }
+                }
+                removeFromAll(u);
+                height[u] = newHeight;
+                if (newHeight >= V)
+                {
+                    return;
+                }
+                addToAll(u);
+            }
+        }
+
+        // Discharge active vertices highest first until none is left
+        void run(int target, int excluded)
+        {
+            long long relabelThreshold = (long long)GLOBAL_RELABEL_FACTOR * V + (long long)arcHead.size() / 2;
+            globalRelabel(target, excluded);
+
+            while (true)
+            {
+                while (maxActive >= 0 && activeHead[maxActive] == -1)
+                {
+                    maxActive--;
+                }
+                if (maxActive < 0)
+                {
+                    break;
+                }
+
+                int u = activeHead[maxActive];
+                activeHead[maxActive] = nextActive[u];
+                discharge(u, target);
+
+                if (work > relabelThreshold)
+                {
+                    globalRelabel(target, excluded);
+                }
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct an empty network with the given number of vertices
+         * @param vertices Number of vertices
+         */
+        PushRelabel(int vertices) : V(vertices) {}
+
+        /**
+         * @brief Add an edge as a pair of residual arcs
+         * @param from Source vertex
+         * @param to Destination vertex
+         * @param cap Residual capacity from -> to
+         * @param reverseCap Residual capacity to -> from (nonzero when flow already runs on the edge)
+         * @return Index of the edge
+         */
+        int addEdge(int from, int to, int cap, int reverseCap = 0)
+        {
+            edgeFrom.push_back(from);
+            edgeTo.push_back(to);
+            edgeCap.push_back(cap);
+            edgeReverseCap.push_back(reverseCap);
+            return edgeFrom.size() - 1;
+        }
+
+        /**
+         * @brief Compute a maximum flow on top of the given residual capacities
+         * @param source Source vertex
+         * @param sink Sink vertex
+         * @param parallelGlobalRelabel Run the global-relabel BFS on several threads
+         * @param threads Number of threads for the BFS (0 = hardware concurrency)
+         * @return Value of the flow that was added
+         */
+        long long maxFlow(int source, int sink, bool parallelGlobalRelabel = false, int threads = 0)
+        {
+            parallelRelabel = parallelGlobalRelabel;
+            numThreads = threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+
+            buildArcs();
+            excess.assign(V, 0);
+            currentArc.assign(V, 0);
+            nextActive.assign(V, -1);
+            allNext.assign(V, -1);
+            allPrev.assign(V, -1);
+            if (source == sink)
+            {
+                return 0;
+            }
+
+            // Saturate every arc out of the source
+            for (int a = arcStart[source]; a < arcStart[source + 1]; a++)
+            {
+                int v = arcHead[a];
+                if (v != source && residual[a] > 0)
+                {
+                    excess[v] += residual[a];
+                    excess[source] -= residual[a];
+                    residual[arcReverse[a]] += residual[a];
+                    residual[a] = 0;
+                }
+            }
+
+            // Phase 1: maximum preflow towards the sink
+            run(sink, source);
+            long long flowValue = excess[sink];
+
+            // Phase 2: send the remaining excess back to the source
+            run(source, sink);
+
+            return flowValue;
+        }
+
+        /**
+         * @brief Flow added on an edge by maxFlow (negative if it was pushed back)
+         * @param edgeIndex Index returned by addEdge
+         */
+        int getFlow(int edgeIndex) const
+        {
+            return edgeCap[edgeIndex] - residual[forwardArc[edgeIndex]];
+        }
+    };
+    /**
+     * @brief Algorithms available through FlowNetwork::minCostMaxFlow
+     */
+    enum class MinCostAlgorithm
+    {
+        SPFA,            // Successive shortest paths with Bellman-Ford (SPFA)
+        CapacityScaling, // Dijkstra on reduced costs with capacity scaling
+        CostScaling      // Goldberg-Tarjan cost-scaling push-relabel
+    };
+
     /**
      * @brief Flow Network class for maximum flow problems
      */
@@ -238,13 +667,45 @@ public:
             return flow;
         }
 
+        /**
+         * @brief Highest-label push-relabel maximum flow (see PushRelabel)
+         * @param s Source vertex
+         * @param t Sink vertex
+         * @param parallelGlobalRelabel Run the global-relabel BFS on several threads
+         * @return Maximum flow from s to t
+         */
+        int pushRelabelMaxFlow(int s, int t, bool parallelGlobalRelabel = false)
+        {
+            // Each forward/backward edge pair becomes one pair of arcs; any flow
+            // already in the network shows up as residual capacity on the backward arc
+            PushRelabel solver(n);
+            for (size_t i = 0; i < edges.size(); i += 2)
+            {
+                solver.addEdge(edges[i].from, edges[i].to, edges[i].cap - edges[i].flow,
+                               edges[i + 1].cap - edges[i + 1].flow);
+            }
+
+            int flow = solver.maxFlow(s, t, parallelGlobalRelabel);
+
+            for (size_t i = 0; i < edges.size(); i += 2)
+            {
+                int added = solver.getFlow(i / 2);
+                edges[i].flow += added;
+                edges[i + 1].flow -= added;
+            }
+
+            return flow;
+        }
+
         /**
          * @brief Min-cost Max-flow algorithm using successive shortest path
+         *
+         * Each augmenting path comes from SPFA (Bellman-Ford with a queue), O(VE) per path.
          * @param s Source vertex
          * @param t Sink vertex
          * @return Pair (max flow, min cost)
          */
-        std::pair<int, int> minCostMaxFlow(int s, int t)
+        std::pair<int, int> minCostMaxFlowSPFA(int s, int t)
         {
             int flow = 0;
             int cost = 0;
@@ -321,81 +782,504 @@ public:
         }
 
         /**
-         * @brief Get the maximum flow in the network
-         * @return Total flow out of the source
+         * @brief Min-cost max-flow with Dijkstra over reduced costs and capacity scaling
+         *
+         * The max-flow value F is found first (push-relabel), then F units are routed from
+         * s to t at minimum cost. Node potentials keep every reduced cost
+         * cost(u, v) + p(u) - p(v) non-negative, so each shortest path is a Dijkstra run
+         * instead of Bellman-Ford. Capacity scaling only looks at arcs with at least
+         * delta residual capacity and halves delta each phase, so a few augmentations
+         * move most of the flow even when flow values are large.
+         *
+         * Time complexity: O(E log U * E log V)
+         * @param s Source vertex
+         * @param t Sink vertex
+         * @return Pair (max flow, min cost)
          */
-        int getTotalFlow(int s)
+        std::pair<int, int> minCostMaxFlowCapacityScaling(int s, int t)
         {
-            int total = 0;
-            for (int eid : adj[s])
+            long long start_cost = totalCost();
+            long long target = maxFlowValue(s, t);
+
+            std::vector<long long> imbalance(n, 0); // Positive = excess, negative = deficit
+            std::vector<long long> potential(n, 0);
+            imbalance[s] = target;
+            imbalance[t] = -target;
+
+            long long delta = 1;
+            for (const Edge &e : edges)
             {
-                if (edges[eid].from == s)
+                while (delta * 2 <= std::max<long long>(target, e.cap - e.flow))
                 {
-                    total += edges[eid].flow;
+                    delta *= 2;
                 }
             }
-            return total;
-        }
 
-        /**
-         * @brief Print the current flow network
-         */
-        void printFlow()
-        {
-            std::cout << "Current Flow Network:\n";
-            for (int i = 0; i < edges.size(); i += 2)
+            const long long UNREACHED = std::numeric_limits<long long>::max();
+            std::vector<long long> dist(n, UNREACHED);
+            std::vector<int> parent(n, -1);
+            std::vector<int> touched, sources, path;
+
+            // Per-round state of the multi-path augmentation
+            int round = 0;
+            std::vector<int> dead(n, 0), arc_round(n, 0);
+            std::vector<size_t> next_arc(n, 0);
+            std::vector<bool> on_path(n, false);
+
+            for (; delta >= 1; delta /= 2)
             {
-                Edge &e = edges[i];
-                if (e.cap > 0)
-                { // Only print forward edges
-                    std::cout << "Edge " << e.from << " -> " << e.to
-                              << ": Flow " << e.flow << "/" << e.cap;
-                    if (e.cost != 0)
+                // Arcs that just entered the delta-residual network must not have negative reduced cost
+                for (size_t i = 0; i < edges.size(); i++)
+                {
+                    Edge &e = edges[i];
+                    long long residual = e.cap - e.flow;
+                    if (residual >= delta && e.cost + potential[e.from] - potential[e.to] < 0)
                     {
-                        std::cout << " (Cost: " << e.cost << ")";
+                        e.flow += residual;
+                        edges[i ^ 1].flow -= residual;
+                        imbalance[e.from] -= residual;
+                        imbalance[e.to] += residual;
                     }
-                    std::cout << "\n";
                 }
-            }
-        }
-    };
 
-    /**
-     * @brief Implementation of the Hungarian algorithm for assignment problems
-     * @param cost Cost matrix where cost[i][j] is the cost of assigning worker i to job j
-     * @return Vector of assignments where result[i] = j means worker i is assigned to job j
-     */
-    std::vector<int> hungarianAlgorithm(const std::vector<std::vector<int>> &cost_matrix)
-    {
-        // Make a copy of the cost matrix as we'll modify it
-        std::vector<std::vector<int>> cost = cost_matrix;
-        int n = cost.size();
+                while (true)
+                {
+                    // Dijkstra from every node with excess >= delta to the nearest deficit <= -delta
+                    using Entry = std::pair<long long, int>;
+                    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> pq;
+                    sources.clear();
+                    for (int v = 0; v < n; v++)
+                    {
+                        if (imbalance[v] >= delta)
+                        {
+                            dist[v] = 0;
+                            touched.push_back(v);
+                            sources.push_back(v);
+                            pq.push({0, v});
+                        }
+                    }
 
-        // Ensure the matrix is square by adding dummy rows/columns if needed
-        int max_dim = std::max(n, static_cast<int>(cost[0].size()));
-        cost.resize(max_dim, std::vector<int>(max_dim, 0));
-        for (int i = 0; i < n; i++)
-        {
-            cost[i].resize(max_dim, 0);
-        }
+                    int reached = -1;
+                    while (!pq.empty())
+                    {
+                        auto [d, u] = pq.top();
+                        pq.pop();
+                        if (d > dist[u])
+                            continue;
+                        if (imbalance[u] <= -delta)
+                        {
+                            reached = u;
+                            break;
+                        }
 
-        std::vector<int> lx(max_dim, 0);  // Labels for workers
-        std::vector<int> ly(max_dim, 0);  // Labels for jobs
-        std::vector<int> mx(max_dim, -1); // Current assignment for workers
-        std::vector<int> my(max_dim, -1); // Current assignment for jobs
+                        for (int eid : adj[u])
+                        {
+                            const Edge &e = edges[eid];
+                            if (e.cap - e.flow < delta)
+                                continue;
 
-        // Step 1: Initial labeling
-        for (int x = 0; x < max_dim; x++)
-        {
-            lx[x] = *std::max_element(cost[x].begin(), cost[x].end());
-        }
+                            long long nd = d + e.cost + potential[u] - potential[e.to];
+                            if (nd < dist[e.to])
+                            {
+                                if (dist[e.to] == UNREACHED)
+                                    touched.push_back(e.to);
+                                dist[e.to] = nd;
+                                parent[e.to] = eid;
+                                pq.push({nd, e.to});
+                            }
+                        }
+                    }
 
-        // Main loop of the Hungarian algorithm
-        for (int root = 0; root < max_dim; root++)
-        {
-            // If worker already assigned, skip
-            if (mx[root] != -1)
-                continue;
+                    if (reached != -1)
+                    {
+                        // Shift potentials so the path has zero reduced cost (unreached nodes keep theirs)
+                        long long limit = dist[reached];
+                        for (int v : touched)
+                        {
+                            potential[v] += std::min(dist[v], limit) - limit;
+                        }
+
+                        // Every shortest path now has zero reduced cost: augment along such
+                        // paths from each excess node (DFS with current-arc pointers and dead-end
+                        // marks) so one Dijkstra run pays for many augmentations
+                        round++;
+                        for (int start : sources)
+                        {
+                            while (imbalance[start] >= delta && dead[start] != round)
+                            {
+                                int u = start;
+                                on_path[u] = true;
+                                while (imbalance[u] > -delta)
+                                {
+                                    if (arc_round[u] != round)
+                                    {
+                                        arc_round[u] = round;
+                                        next_arc[u] = 0;
+                                    }
+
+                                    bool advanced = false;
+                                    for (; next_arc[u] < adj[u].size(); next_arc[u]++)
+                                    {
+                                        int eid = adj[u][next_arc[u]];
+                                        const Edge &e = edges[eid];
+                                        if (e.cap - e.flow >= delta && dead[e.to] != round && !on_path[e.to] &&
+                                            e.cost + potential[u] - potential[e.to] == 0)
+                                        {
+                                            path.push_back(eid);
+                                            on_path[e.to] = true;
+                                            u = e.to;
+                                            advanced = true;
+                                            break;
+                                        }
+                                    }
+
+                                    if (!advanced)
+                                    {
+                                        dead[u] = round;
+                                        on_path[u] = false;
+                                        if (path.empty())
+                                            break;
+                                        u = edges[path.back()].from;
+                                        path.pop_back();
+                                        next_arc[u]++;
+                                    }
+                                }
+
+                                if (path.empty())
+                                    break;
+
+                                // Augment as much as the path and both endpoints allow
+                                long long amount = std::min(imbalance[start], -imbalance[u]);
+                                for (int eid : path)
+                                {
+                                    amount = std::min<long long>(amount, edges[eid].cap - edges[eid].flow);
+                                }
+                                for (int eid : path)
+                                {
+                                    edges[eid].flow += amount;
+                                    edges[eid ^ 1].flow -= amount;
+                                    on_path[edges[eid].to] = false;
+                                }
+                                on_path[start] = false;
+                                imbalance[start] -= amount;
+                                imbalance[u] += amount;
+                                path.clear();
+                            }
+                        }
+                    }
+
+                    for (int v : touched)
+                    {
+                        dist[v] = UNREACHED;
+                        parent[v] = -1;
+                    }
+                    touched.clear();
+
+                    if (reached == -1)
+                        break;
+                }
+            }
+
+            return {static_cast<int>(target), static_cast<int>(totalCost() - start_cost)};
+        }
+
+        /**
+         * @brief Min-cost max-flow by cost scaling (Goldberg-Tarjan push-relabel)
+         *
+         * Starts from a maximum flow found by push-relabel and keeps it feasible while
+         * cancelling negative-cost cycles implicitly. Costs are multiplied by n + 1;
+         * refine(eps) turns an eps-optimal flow into an (eps / factor)-optimal one, and
+         * a 1-optimal flow on the scaled costs is optimal for the original ones.
+         * Suited to the largest instances, where even the Dijkstra runs add up.
+         *
+         * Time complexity: O(V^2 E log(V C))
+         * @param s Source vertex
+         * @param t Sink vertex
+         * @return Pair (max flow, min cost)
+         */
+        std::pair<int, int> minCostMaxFlowCostScaling(int s, int t)
+        {
+            const long long SCALE_FACTOR = 4;
+            long long start_cost = totalCost();
+            int flow = pushRelabelMaxFlow(s, t);
+
+            long long alpha = n + 1;
+            long long epsilon = 0;
+            for (const Edge &e : edges)
+            {
+                epsilon = std::max(epsilon, std::abs(static_cast<long long>(e.cost)) * alpha);
+            }
+
+            std::vector<long long> price(n, 0);
+            std::vector<long long> excess(n);
+            std::vector<size_t> current(n);
+            std::queue<int> active;
+
+            auto reducedCost = [&](const Edge &e)
+            {
+                return e.cost * alpha + price[e.from] - price[e.to];
+            };
+
+            // Global price update: lower each price by epsilon times its distance to the nearest
+            // deficit, where a residual arc is floor(reduced cost / epsilon) + 1 steps long
+            // (0 if admissible). The flow stays epsilon-optimal and later pushes need far
+            // fewer single-step relabels.
+            const long long UNREACHED = std::numeric_limits<long long>::max();
+            std::vector<long long> steps(n);
+            auto priceUpdate = [&]()
+            {
+                using Entry = std::pair<long long, int>;
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> pq;
+                int pending = 0;
+                for (int v = 0; v < n; v++)
+                {
+                    steps[v] = excess[v] < 0 ? 0 : UNREACHED;
+                    if (excess[v] < 0)
+                        pq.push({0, v});
+                    if (excess[v] > 0)
+                        pending++;
+                }
+
+                // Stop once every excess node is settled; the rest move by the last distance
+                long long level = 0;
+                while (!pq.empty() && pending > 0)
+                {
+                    auto [d, w] = pq.top();
+                    pq.pop();
+                    if (d > steps[w])
+                        continue;
+                    level = d;
+                    if (excess[w] > 0)
+                        pending--;
+
+                    for (int eid : adj[w])
+                    {
+                        const Edge &back = edges[eid ^ 1]; // Residual arc into w
+                        if (back.cap <= back.flow)
+                            continue;
+
+                        long long rc = reducedCost(back);
+                        long long nd = d + (rc < 0 ? 0 : rc / epsilon + 1);
+                        if (nd < steps[back.from])
+                        {
+                            steps[back.from] = nd;
+                            pq.push({nd, back.from});
+                        }
+                    }
+                }
+
+                for (int v = 0; v < n; v++)
+                {
+                    price[v] -= epsilon * std::min(steps[v], level);
+                    current[v] = 0;
+                }
+            };
+
+            while (epsilon > 1)
+            {
+                epsilon = std::max(1LL, epsilon / SCALE_FACTOR);
+
+                // Refine: saturate every admissible arc, then push the resulting excess along
+                // admissible arcs (reduced cost < 0) and relabel when none is left
+                std::fill(excess.begin(), excess.end(), 0);
+                for (size_t i = 0; i < edges.size(); i++)
+                {
+                    Edge &e = edges[i];
+                    if (e.cap > e.flow && reducedCost(e) < 0)
+                    {
+                        int residual = e.cap - e.flow;
+                        e.flow += residual;
+                        edges[i ^ 1].flow -= residual;
+                        excess[e.from] -= residual;
+                        excess[e.to] += residual;
+                    }
+                }
+                priceUpdate();
+                for (int v = 0; v < n; v++)
+                {
+                    if (excess[v] > 0)
+                        active.push(v);
+                }
+                long long relabels = 0;
+
+                while (!active.empty())
+                {
+                    int v = active.front();
+                    active.pop();
+
+                    while (excess[v] > 0)
+                    {
+                        if (current[v] == adj[v].size())
+                        {
+                            // Relabel: lower the price just enough to make an arc admissible
+                            long long best = std::numeric_limits<long long>::min();
+                            for (int eid : adj[v])
+                            {
+                                const Edge &e = edges[eid];
+                                if (e.cap > e.flow)
+                                    best = std::max(best, price[e.to] - e.cost * alpha);
+                            }
+                            price[v] = best - epsilon;
+                            current[v] = 0;
+                            if (++relabels % n == 0)
+                                priceUpdate();
+                            continue;
+                        }
+
+                        int eid = adj[v][current[v]];
+                        Edge &e = edges[eid];
+                        if (e.cap > e.flow && reducedCost(e) < 0)
+                        {
+                            long long amount = std::min<long long>(excess[v], e.cap - e.flow);
+                            e.flow += amount;
+                            edges[eid ^ 1].flow -= amount;
+                            excess[v] -= amount;
+                            if (excess[e.to] <= 0 && excess[e.to] + amount > 0)
+                                active.push(e.to);
+                            excess[e.to] += amount;
+                        }
+                        else
+                        {
+                            current[v]++;
+                        }
+                    }
+                }
+            }
+
+            return {flow, static_cast<int>(totalCost() - start_cost)};
+        }
+
+        /**
+         * @brief Min-cost Max-flow
+         * @param s Source vertex
+         * @param t Sink vertex
+         * @param algorithm SPFA successive shortest paths, capacity scaling (default) or cost scaling
+         * @return Pair (max flow, min cost)
+         */
+        std::pair<int, int> minCostMaxFlow(int s, int t, MinCostAlgorithm algorithm = MinCostAlgorithm::CapacityScaling)
+        {
+            switch (algorithm)
+            {
+            case MinCostAlgorithm::SPFA:
+                return minCostMaxFlowSPFA(s, t);
+            case MinCostAlgorithm::CostScaling:
+                return minCostMaxFlowCostScaling(s, t);
+            default:
+                return minCostMaxFlowCapacityScaling(s, t);
+            }
+        }
+
+        /**
+         * @brief Get the maximum flow in the network
+         * @return Total flow out of the source
+         */
+        int getTotalFlow(int s)
+        {
+            int total = 0;
+            for (int eid : adj[s])
+            {
+                if (edges[eid].from == s)
+                {
+                    total += edges[eid].flow;
+                }
+            }
+            return total;
+        }
+
+        /**
+         * @brief Total cost of the current flow (sum of flow * cost over forward edges)
+         */
+        long long totalCost() const
+        {
+            long long total = 0;
+            for (size_t i = 0; i < edges.size(); i += 2)
+            {
+                total += static_cast<long long>(edges[i].flow) * edges[i].cost;
+            }
+            return total;
+        }
+
+        /**
+         * @brief Value of the flow that could still be added from s to t (flows are left unchanged)
+         */
+        long long maxFlowValue(int s, int t) const
+        {
+            PushRelabel solver(n);
+            for (size_t i = 0; i < edges.size(); i += 2)
+            {
+                solver.addEdge(edges[i].from, edges[i].to, edges[i].cap - edges[i].flow,
+                               edges[i + 1].cap - edges[i + 1].flow);
+            }
+            return solver.maxFlow(s, t);
+        }
+
+        /**
+         * @brief Get all edges (forward edges at even indices, their backward edges after them)
+         */
+        const std::vector<Edge> &getEdges() const
+        {
+            return edges;
+        }
+
+        /**
+         * @brief Print the current flow network
+         */
+        void printFlow()
+        {
+            std::cout << "Current Flow Network:\n";
+            for (int i = 0; i < edges.size(); i += 2)
+            {
+                Edge &e = edges[i];
+                if (e.cap > 0)
+                { // Only print forward edges
+                    std::cout << "Edge " << e.from << " -> " << e.to
+                              << ": Flow " << e.flow << "/" << e.cap;
+                    if (e.cost != 0)
+                    {
+                        std::cout << " (Cost: " << e.cost << ")";
+                    }
+                    std::cout << "\n";
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Implementation of the Hungarian algorithm for assignment problems
+     * @param cost Cost matrix where cost[i][j] is the cost of assigning worker i to job j
+     * @return Vector of assignments where result[i] = j means worker i is assigned to job j
+     */
+    std::vector<int> hungarianAlgorithm(const std::vector<std::vector<int>> &cost_matrix)
+    {
+        // Make a copy of the cost matrix as we'll modify it
+        std::vector<std::vector<int>> cost = cost_matrix;
+        int n = cost.size();
+
+        // Ensure the matrix is square by adding dummy rows/columns if needed
+        int max_dim = std::max(n, static_cast<int>(cost[0].size()));
+        cost.resize(max_dim, std::vector<int>(max_dim, 0));
+        for (int i = 0; i < n; i++)
+        {
+            cost[i].resize(max_dim, 0);
+        }
+
+        std::vector<int> lx(max_dim, 0);  // Labels for workers
+        std::vector<int> ly(max_dim, 0);  // Labels for jobs
+        std::vector<int> mx(max_dim, -1); // Current assignment for workers
+        std::vector<int> my(max_dim, -1); // Current assignment for jobs
+
+        // Step 1: Initial labeling
+        for (int x = 0; x < max_dim; x++)
+        {
+            lx[x] = *std::max_element(cost[x].begin(), cost[x].end());
+        }
+
+        // Main loop of the Hungarian algorithm
+        for (int root = 0; root < max_dim; root++)
+        {
+            // If worker already assigned, skip
+            if (mx[root] != -1)
+                continue;
 
             std::vector<bool> S(max_dim, false);  // Set of workers in the tree
             std::vector<bool> T(max_dim, false);  // Set of jobs in the tree
@@ -546,9 +1430,9 @@ public:
                 if (graph[i][j])
                 {
                     // Find the edge index in the FlowNetwork
-                    for (size_t e = 0; e < network.edges.size(); e += 2)
+                    for (size_t e = 0; e < network.getEdges().size(); e += 2)
                     {
-                        if (network.edges[e].from == i && network.edges[e].to == n + j && network.edges[e].flow > 0)
+                        if (network.getEdges()[e].from == i && network.getEdges()[e].to == n + j && network.getEdges()[e].flow > 0)
                         {
                             matches.emplace_back(i, j);
                             break;
@@ -562,68 +1446,629 @@ public:
     }
 
     /**
-     * @brief Solve the Traveling Salesman Problem using dynamic programming (Held-Karp)
-     * @param dist Distance matrix where dist[i][j] is the distance from city i to city j
-     * @return Minimum distance and the optimal tour
+     * @brief Maximum bipartite matching with Hopcroft-Karp on CSR adjacency
+     *
+     * Each phase runs one BFS from all free workers to layer the graph, then
+     * augments along a maximal set of vertex-disjoint shortest paths with
+     * iterative DFS (current-arc pointers, no recursion).
+     *
+     * Time complexity: O(E sqrt(V))
+     * @param n Number of workers (left side)
+     * @param m Number of jobs (right side)
+     * @param offsets n + 1 row starts into adjacency
+     * @param adjacency Jobs each worker can do, worker by worker
+     * @return Number of matches and match[i] = job of worker i (-1 if unmatched)
      */
-    std::pair<int, std::vector<int>> tspDP(const std::vector<std::vector<int>> &dist)
+    std::pair<int, std::vector<int>> hopcroftKarp(
+        int n, int m, const std::vector<int> &offsets, const std::vector<int> &adjacency)
     {
-        int n = dist.size();
-
-        // dp[mask][i] = minimum distance of path that visits all vertices in mask and ends at i
-        std::vector<std::vector<int>> dp(1 << n, std::vector<int>(n, INF));
+        std::vector<int> match_left(n, -1), match_right(m, -1);
+        std::vector<int> dist(n), next_arc(n), queue, path;
+        int matches = 0;
 
-        // parent[mask][i] = previous vertex in the shortest path to dp[mask][i]
-        std::vector<std::vector<int>> parent(1 << n, std::vector<int>(n, -1));
-
-        // Base case: start at vertex 0
-        dp[1][0] = 0; // Only vertex 0 is visited, ending at 0
+        // Greedy start: most workers find a free job right away
+        for (int i = 0; i < n; i++)
+        {
+            for (int a = offsets[i]; a < offsets[i + 1]; a++)
+            {
+                if (match_right[adjacency[a]] == -1)
+                {
+                    match_left[i] = adjacency[a];
+                    match_right[adjacency[a]] = i;
+                    matches++;
+                    break;
+                }
+            }
+        }
 
-        // Iterate through all subsets of vertices
-        for (int mask = 1; mask < (1 << n); mask++)
+        while (true)
         {
-            // Skip if vertex 0 is not in the subset
-            if (!(mask & 1))
-                continue;
+            // BFS layering from the free workers
+            queue.clear();
+            for (int i = 0; i < n; i++)
+            {
+                dist[i] = match_left[i] == -1 ? 0 : INF;
+                if (match_left[i] == -1)
+                    queue.push_back(i);
+            }
 
-            // Try to add a new vertex to the path
-            for (int u = 0; u < n; u++)
+            bool found = false;
+            for (size_t q = 0; q < queue.size(); q++)
             {
-                // Skip if u is not in the current subset
-                if (!(mask & (1 << u)))
-                    continue;
+                int i = queue[q];
+                for (int a = offsets[i]; a < offsets[i + 1]; a++)
+                {
+                    int w = match_right[adjacency[a]];
+                    if (w == -1)
+                        found = true;
+                    else if (dist[w] == INF)
+                    {
+                        dist[w] = dist[i] + 1;
+                        queue.push_back(w);
+                    }
+                }
+            }
 
-                // The subset without u
-                int prev_mask = mask ^ (1 << u);
+            if (!found)
+                break;
 
-                // Skip if prev_mask is empty (only happens for u=0, mask=1)
-                if (prev_mask == 0)
+            // DFS along the layers from every free worker
+            std::copy(offsets.begin(), offsets.end() - 1, next_arc.begin());
+            for (int root = 0; root < n; root++)
+            {
+                if (match_left[root] != -1)
                     continue;
 
-                // Find the best previous vertex
-                for (int v = 0; v < n; v++)
+                path.assign(1, root);
+                while (!path.empty())
                 {
-                    // Skip if v is not in prev_mask
-                    if (!(prev_mask & (1 << v)))
+                    int i = path.back();
+                    if (next_arc[i] == offsets[i + 1])
+                    {
+                        // Dead end: drop i from the layered graph
+                        dist[i] = INF;
+                        path.pop_back();
+                        if (!path.empty())
+                            next_arc[path.back()]++;
                         continue;
+                    }
 
-                    // Relax the edge v->u
-                    if (dp[prev_mask][v] + dist[v][u] < dp[mask][u])
+                    int job = adjacency[next_arc[i]];
+                    int w = match_right[job];
+                    if (w == -1)
                     {
-                        dp[mask][u] = dp[prev_mask][v] + dist[v][u];
-                        parent[mask][u] = v;
+                        // Free job: flip the matching along the path
+                        for (int x : path)
+                        {
+                            int j = adjacency[next_arc[x]];
+                            match_left[x] = j;
+                            match_right[j] = x;
+                        }
+                        matches++;
+                        break;
                     }
+
+                    if (dist[w] == dist[i] + 1)
+                        path.push_back(w);
+                    else
+                        next_arc[i]++;
                 }
             }
         }
 
-        // Find the shortest Hamiltonian path that visits all vertices and returns to 0
-        int min_dist = INF;
-        int last_vertex = -1;
+        return {matches, match_left};
+    }
 
-        for (int u = 1; u < n; u++)
+    /**
+     * @brief Smallest and second smallest of row[j] * scale - dual[j] over j
+     *
+     * This is the inner loop of both LAPJV and the auction algorithm. With AVX2 it
+     * scans 8 columns at a time, keeping the two best values per lane, and merges
+     * the lanes at the end. Ties go to the lower column index, as in the scalar loop.
+     * @param row Costs of one row
+     * @param dual Column duals
+     * @param n Number of columns (at least 2)
+     * @param scale Cost multiplier
+     * @return (best value, its column, second best value, its column)
+     */
+    static std::tuple<int, int, int, int> findTwoSmallest(const int *row, const int *dual, int n, int scale = 1)
+    {
+        int u1 = INF, u2 = INF, j1 = -1, j2 = -1;
+        int j = 0;
+
+#ifdef __AVX2__
+        if (n >= 16)
         {
-            if (dp[(1 << n) - 1][u] + dist[u][0] < min_dist)
+            __m256i min1 = _mm256_set1_epi32(INF), min2 = _mm256_set1_epi32(INF);
+            __m256i idx1 = _mm256_set1_epi32(-1), idx2 = _mm256_set1_epi32(-1);
+            __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            const __m256i step = _mm256_set1_epi32(8);
+            const __m256i factor = _mm256_set1_epi32(scale);
+
+            for (; j + 8 <= n; j += 8)
+            {
+                __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row + j));
+                __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dual + j));
+                __m256i h = _mm256_sub_epi32(scale == 1 ? c : _mm256_mullo_epi32(c, factor), d);
+
+                __m256i below1 = _mm256_cmpgt_epi32(min1, h);
+                __m256i below2 = _mm256_cmpgt_epi32(min2, h);
+
+                // h < min1: old best becomes second; otherwise h may replace the second
+                min2 = _mm256_blendv_epi8(_mm256_blendv_epi8(min2, h, below2), min1, below1);
+                idx2 = _mm256_blendv_epi8(_mm256_blendv_epi8(idx2, idx, below2), idx1, below1);
+                min1 = _mm256_blendv_epi8(min1, h, below1);
+                idx1 = _mm256_blendv_epi8(idx1, idx, below1);
+                idx = _mm256_add_epi32(idx, step);
+            }
+
+            alignas(32) int lane_value[16], lane_index[16];
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lane_value), min1);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lane_value + 8), min2);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lane_index), idx1);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lane_index + 8), idx2);
+
+            // Merge lane candidates in (value, column) order
+            for (int k = 0; k < 16; k++)
+            {
+                int value = lane_value[k], col = lane_index[k];
+                if (col < 0)
+                    continue;
+                if (value < u1 || (value == u1 && col < j1))
+                {
+                    u2 = u1;
+                    j2 = j1;
+                    u1 = value;
+                    j1 = col;
+                }
+                else if (value < u2 || (value == u2 && col < j2))
+                {
+                    u2 = value;
+                    j2 = col;
+                }
+            }
+        }
+#endif
+
+        for (; j < n; j++)
+        {
+            int h = row[j] * scale - dual[j];
+            if (h < u1)
+            {
+                u2 = u1;
+                j2 = j1;
+                u1 = h;
+                j1 = j;
+            }
+            else if (h < u2)
+            {
+                u2 = h;
+                j2 = j;
+            }
+        }
+
+        return {u1, j1, u2, j2};
+    }
+
+    /**
+     * @brief Minimum-cost assignment with the Jonker-Volgenant algorithm (LAPJV)
+     *
+     * Column reduction, reduction transfer and two rounds of augmenting row
+     * reduction (an auction-like pass) assign most rows cheaply; each remaining
+     * free row is then assigned by a Dijkstra-style shortest augmenting path
+     * over the dense reduced costs.
+     *
+     * Time complexity: O(n^3) worst case, far less on random instances
+     * @param cost Flat n x n cost matrix, row-major
+     * @param n Matrix dimension
+     * @return result[i] = column assigned to row i (minimizing the total cost)
+     */
+    std::vector<int> lapjv(const std::vector<int> &cost, int n)
+    {
+        std::vector<int> rowsol(n, -1), colsol(n, -1), v(n);
+        if (n == 1)
+            return {0};
+
+        // Column reduction: v[j] = column minimum, assign each column to its argmin row if free
+        std::vector<int> col_arg(n, 0);
+        std::copy(cost.begin(), cost.begin() + n, v.begin());
+        for (int i = 1; i < n; i++)
+        {
+            const int *row = &cost[static_cast<size_t>(i) * n];
+            for (int j = 0; j < n; j++)
+            {
+                if (row[j] < v[j])
+                {
+                    v[j] = row[j];
+                    col_arg[j] = i;
+                }
+            }
+        }
+
+        std::vector<int> matches(n, 0);
+        for (int j = n - 1; j >= 0; j--)
+        {
+            int imin = col_arg[j];
+            if (++matches[imin] == 1)
+            {
+                rowsol[imin] = j;
+                colsol[j] = imin;
+            }
+            else if (v[j] < v[rowsol[imin]])
+            {
+                int j1 = rowsol[imin];
+                rowsol[imin] = j;
+                colsol[j] = imin;
+                colsol[j1] = -1;
+            }
+            else
+            {
+                colsol[j] = -1;
+            }
+        }
+
+        // Reduction transfer: rows with exactly one column give up the slack to the next best
+        std::vector<int> free_rows;
+        for (int i = 0; i < n; i++)
+        {
+            if (matches[i] == 0)
+            {
+                free_rows.push_back(i);
+            }
+            else if (matches[i] == 1)
+            {
+                int j1 = rowsol[i];
+                auto [u1, best, u2, second] = findTwoSmallest(&cost[static_cast<size_t>(i) * n], v.data(), n);
+                v[j1] -= best == j1 ? u2 : u1;
+            }
+        }
+
+        // Augmenting row reduction (two passes)
+        for (int pass = 0; pass < 2; pass++)
+        {
+            size_t k = 0;
+            size_t previous_free = free_rows.size();
+            size_t num_free = 0;
+            while (k < previous_free)
+            {
+                int i = free_rows[k++];
+                auto [umin, j1, usubmin, j2] = findTwoSmallest(&cost[static_cast<size_t>(i) * n], v.data(), n);
+
+                int i0 = colsol[j1];
+                if (umin < usubmin)
+                {
+                    v[j1] -= usubmin - umin;
+                }
+                else if (i0 >= 0)
+                {
+                    j1 = j2;
+                    i0 = colsol[j2];
+                }
+
+                rowsol[i] = j1;
+                colsol[j1] = i;
+
+                if (i0 >= 0)
+                {
+                    rowsol[i0] = -1;
+                    if (umin < usubmin)
+                        free_rows[--k] = i0; // Try the displaced row again right away
+                    else
+                        free_rows[num_free++] = i0;
+                }
+            }
+            free_rows.resize(num_free);
+        }
+
+        // Augment each remaining free row along a shortest alternating path
+        std::vector<int> d(n), pred(n), collist(n);
+        for (int freerow : free_rows)
+        {
+            const int *frow = &cost[static_cast<size_t>(freerow) * n];
+            for (int j = 0; j < n; j++)
+            {
+                d[j] = frow[j] - v[j];
+                pred[j] = freerow;
+                collist[j] = j;
+            }
+
+            int low = 0, up = 0, last = 0, minimum = 0, endofpath = -1;
+            bool unassigned_found = false;
+            do
+            {
+                if (up == low)
+                {
+                    // Collect the columns at the new minimum distance
+                    last = low - 1;
+                    minimum = d[collist[up++]];
+                    for (int k = up; k < n; k++)
+                    {
+                        int j = collist[k];
+                        int h = d[j];
+                        if (h <= minimum)
+                        {
+                            if (h < minimum)
+                            {
+                                up = low;
+                                minimum = h;
+                            }
+                            collist[k] = collist[up];
+                            collist[up++] = j;
+                        }
+                    }
+                    for (int k = low; k < up; k++)
+                    {
+                        if (colsol[collist[k]] < 0)
+                        {
+                            endofpath = collist[k];
+                            unassigned_found = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (!unassigned_found)
+                {
+                    // Scan the row assigned to the next minimum column
+                    int j1 = collist[low++];
+                    int i = colsol[j1];
+                    const int *row = &cost[static_cast<size_t>(i) * n];
+                    int h = row[j1] - v[j1] - minimum;
+
+                    for (int k = up; k < n; k++)
+                    {
+                        int j = collist[k];
+                        int v2 = row[j] - v[j] - h;
+                        if (v2 < d[j])
+                        {
+                            pred[j] = i;
+                            if (v2 == minimum)
+                            {
+                                if (colsol[j] < 0)
+                                {
+                                    endofpath = j;
+                                    unassigned_found = true;
+                                    break;
+                                }
+                                collist[k] = collist[up];
+                                collist[up++] = j;
+                            }
+                            d[j] = v2;
+                        }
+                    }
+                }
+            } while (!unassigned_found);
+
+            // Update the duals of the columns that were finalized
+            for (int k = 0; k <= last; k++)
+            {
+                int j1 = collist[k];
+                v[j1] += d[j1] - minimum;
+            }
+
+            // Flip the assignment along the path
+            int i;
+            do
+            {
+                i = pred[endofpath];
+                colsol[endofpath] = i;
+                std::swap(endofpath, rowsol[i]);
+            } while (i != freerow);
+        }
+
+        return rowsol;
+    }
+
+    /**
+     * @brief Minimum-cost assignment with a parallel epsilon-scaling auction
+     *
+     * Unassigned rows bid for their cheapest column (in reduced cost
+     * cost * (n + 1) - v[j]) and lower that column's dual by the gap to their
+     * second choice plus epsilon. In each round all bids are computed in
+     * parallel (Jacobi style); every column keeps the lowest bid with an atomic
+     * compare-and-swap, and winners displace the previous owners. Epsilon shrinks
+     * each phase; costs are scaled by n + 1, so epsilon = 1 gives an optimal assignment.
+     *
+     * @param cost Flat n x n cost matrix, row-major (|cost| * (n + 1) must fit in 30 bits)
+     * @param n Matrix dimension
+     * @param numThreads Number of bidding threads (0 = hardware concurrency)
+     * @return result[i] = column assigned to row i, or an empty vector if costs are too large
+     */
+    std::vector<int> auctionAssignment(const std::vector<int> &cost, int n, int numThreads = 0)
+    {
+        const int EPSILON_FACTOR = 10;
+        const size_t MIN_BIDS_PER_THREAD = 64;
+        if (numThreads <= 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        if (n == 1)
+            return {0};
+
+        long long max_abs = 0;
+        for (int c : cost)
+            max_abs = std::max(max_abs, std::abs(static_cast<long long>(c)));
+        long long scale = n + 1;
+        if (max_abs * scale >= (1LL << 30))
+            return {};
+
+        std::vector<int> v(n, 0), owner(n), assigned(n);
+        std::vector<std::atomic<long long>> best_bid(n);
+        const long long NO_BID = std::numeric_limits<long long>::max();
+        for (auto &bid : best_bid)
+            bid.store(NO_BID, std::memory_order_relaxed);
+
+        std::vector<int> unassigned, next_unassigned;
+        std::vector<std::vector<int>> bid_columns(numThreads);
+
+        // Start at one unscaled cost unit: larger values only add bidding wars
+        long long epsilon = std::max(1LL, max_abs);
+        while (true)
+        {
+            std::fill(owner.begin(), owner.end(), -1);
+            std::fill(assigned.begin(), assigned.end(), -1);
+            unassigned.resize(n);
+            for (int i = 0; i < n; i++)
+                unassigned[i] = i;
+
+            while (!unassigned.empty())
+            {
+                // Bidding: rows read v, columns collect the lowest proposed dual
+                // Late rounds have few bidders; spawning threads for them costs more than it saves
+                int active_threads = static_cast<int>(std::min<size_t>(numThreads, std::max<size_t>(1, unassigned.size() / MIN_BIDS_PER_THREAD)));
+                auto bid = [&](int t)
+                {
+                    bid_columns[t].clear();
+                    size_t begin = unassigned.size() * t / active_threads;
+                    size_t end = unassigned.size() * (t + 1) / active_threads;
+                    for (size_t k = begin; k < end; k++)
+                    {
+                        int i = unassigned[k];
+                        auto [u1, j1, u2, j2] = findTwoSmallest(&cost[static_cast<size_t>(i) * n], v.data(), n, scale);
+                        long long new_dual = v[j1] - (static_cast<long long>(u2) - u1) - epsilon;
+                        long long key = new_dual * (1LL << 32) + i;
+
+                        long long current = best_bid[j1].load(std::memory_order_relaxed);
+                        while (key < current && !best_bid[j1].compare_exchange_weak(current, key, std::memory_order_relaxed))
+                        {
+                        }
+                        if (current == NO_BID)
+                            bid_columns[t].push_back(j1);
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                for (int t = 1; t < active_threads; t++)
+                    workers.emplace_back(bid, t);
+                bid(0);
+                for (auto &worker : workers)
+                    worker.join();
+
+                // Assignment: each column goes to its lowest bidder
+                next_unassigned.clear();
+                for (int t = 0; t < active_threads; t++)
+                {
+                    for (int j : bid_columns[t])
+                    {
+                        long long key = best_bid[j].load(std::memory_order_relaxed);
+                        best_bid[j].store(NO_BID, std::memory_order_relaxed);
+                        int winner = static_cast<int>(key & 0xffffffffLL);
+                        v[j] = static_cast<int>((key - winner) / (1LL << 32));
+
+                        if (owner[j] != -1)
+                        {
+                            assigned[owner[j]] = -1;
+                            next_unassigned.push_back(owner[j]);
+                        }
+                        owner[j] = winner;
+                        assigned[winner] = j;
+                    }
+                }
+                for (int i : unassigned)
+                {
+                    if (assigned[i] == -1)
+                        next_unassigned.push_back(i);
+                }
+                unassigned.swap(next_unassigned);
+            }
+
+            if (epsilon == 1)
+                break;
+            epsilon = std::max(1LL, epsilon / EPSILON_FACTOR);
+
+            // Only differences between duals matter; keep them near zero so they stay in range
+            int top = *std::max_element(v.begin(), v.end());
+            for (int &dual : v)
+                dual -= top;
+        }
+
+        return assigned;
+    }
+
+    /**
+     * @brief Minimum-cost assignment for a (possibly rectangular) cost matrix via LAPJV
+     * @param cost_matrix cost_matrix[i][j] = cost of assigning worker i to job j
+     * @return result[i] = job of worker i; indices >= number of jobs are dummy jobs
+     */
+    std::vector<int> minCostAssignment(const std::vector<std::vector<int>> &cost_matrix)
+    {
+        int rows = cost_matrix.size();
+        int cols = rows > 0 ? cost_matrix[0].size() : 0;
+        int dim = std::max(rows, cols);
+
+        // Flatten and pad with zero-cost dummy rows/columns
+        std::vector<int> flat(static_cast<size_t>(dim) * dim, 0);
+        for (int i = 0; i < rows; i++)
+        {
+            std::copy(cost_matrix[i].begin(), cost_matrix[i].end(), flat.begin() + static_cast<size_t>(i) * dim);
+        }
+
+        std::vector<int> result = lapjv(flat, dim);
+        result.resize(rows);
+        return result;
+    }
+
+    /**
+     * @brief Solve the Traveling Salesman Problem using dynamic programming (Held-Karp)
+     * @param dist Distance matrix where dist[i][j] is the distance from city i to city j
+     * @return Minimum distance and the optimal tour
+     */
+    std::pair<int, std::vector<int>> tspDP(const std::vector<std::vector<int>> &dist)
+    {
+        int n = dist.size();
+
+        // dp[mask][i] = minimum distance of path that visits all vertices in mask and ends at i
+        std::vector<std::vector<int>> dp(1 << n, std::vector<int>(n, INF));
+
+        // parent[mask][i] = previous vertex in the shortest path to dp[mask][i]
+        std::vector<std::vector<int>> parent(1 << n, std::vector<int>(n, -1));
+
+        // Base case: start at vertex 0
+        dp[1][0] = 0; // Only vertex 0 is visited, ending at 0
+
+        // Iterate through all subsets of vertices
+        for (int mask = 1; mask < (1 << n); mask++)
+        {
+            // Skip if vertex 0 is not in the subset
+            if (!(mask & 1))
+                continue;
+
+            // Try to add a new vertex to the path
+            for (int u = 0; u < n; u++)
+            {
+                // Skip if u is not in the current subset
+                if (!(mask & (1 << u)))
+                    continue;
+
+                // The subset without u
+                int prev_mask = mask ^ (1 << u);
+
+                // Skip if prev_mask is empty (only happens for u=0, mask=1)
+                if (prev_mask == 0)
+                    continue;
+
+                // Find the best previous vertex
+                for (int v = 0; v < n; v++)
+                {
+                    // Skip if v is not in prev_mask or not reachable yet
+                    if (!(prev_mask & (1 << v)) || dp[prev_mask][v] == INF)
+                        continue;
+
+                    // Relax the edge v->u
+                    if (dp[prev_mask][v] + dist[v][u] < dp[mask][u])
+                    {
+                        dp[mask][u] = dp[prev_mask][v] + dist[v][u];
+                        parent[mask][u] = v;
+                    }
+                }
+            }
+        }
+
+        // Find the shortest Hamiltonian path that visits all vertices and returns to 0
+        int min_dist = INF;
+        int last_vertex = -1;
+
+        for (int u = 1; u < n; u++)
+        {
+            if (dp[(1 << n) - 1][u] + dist[u][0] < min_dist)
             {
                 min_dist = dp[(1 << n) - 1][u] + dist[u][0];
                 last_vertex = u;
@@ -635,6 +2080,7 @@ public:
         int mask = (1 << n) - 1; // All vertices
         int u = last_vertex;
 
+        // The walk ends at vertex 0, whose parent is -1
         while (u != -1)
         {
             path.push_back(u);
@@ -643,15 +2089,341 @@ public:
             u = next_u;
         }
 
-        // Add the starting vertex to complete the cycle
-        path.push_back(0);
-
         // Reverse to get the correct order (starting from 0)
         std::reverse(path.begin(), path.end());
 
         return {min_dist, path};
     }
 
+    /**
+     * @brief Exact TSP engine (Held-Karp) for up to 32 cities
+     *
+     * City 0 is the fixed start and the other m = n - 1 cities are the bits of a
+     * subset mask. Subsets are processed by popcount layer and enumerated with
+     * Gosper's hack, which walks a layer in colexicographic order, so the position
+     * of a subset inside its layer is its combinatorial-number-system rank. A layer
+     * only reads the layer below it, so its subsets are split across threads.
+     *
+     * Every subset stores a row of W costs (W = m rounded up to a whole 256-bit
+     * register), one per city, unreachable for cities outside the subset. Ending a
+     * path at city j is then a contiguous min over prev_row[i] + dist[i][j], which
+     * runs on AVX2 when available. Costs are 16-bit when the tour length allows it.
+     *
+     * Full mode keeps every layer and re-derives the tour from the stored costs.
+     * Memory-bounded mode keeps two layers plus one parent byte per (subset, end city).
+     *
+     * Time complexity: O(2^n * n^2 / lanes) with lanes = 16 or 8
+     * Space complexity: O(2^n * W) full, O(C(n, n/2) * W + 2^n * n / 2 bytes) bounded
+     */
+    template <typename Cost>
+    class HeldKarp
+    {
+    public:
+        // Larger than any tour, and twice it still fits in Cost
+        static constexpr Cost UNREACHABLE = std::numeric_limits<Cost>::max() >> 1;
+
+        HeldKarp(const std::vector<std::vector<int>> &dist, int numThreads, bool memoryBounded)
+            : n(dist.size()), m(n - 1), numThreads(numThreads), memoryBounded(memoryBounded), dist(dist)
+        {
+            const int lanes = 32 / sizeof(Cost);
+            W = (m + lanes - 1) / lanes * lanes;
+
+            for (int i = 0; i <= m; i++)
+            {
+                binom[i][0] = 1;
+                for (int k = 1; k <= m; k++)
+                    binom[i][k] = i == 0 ? 0 : binom[i - 1][k - 1] + binom[i - 1][k];
+            }
+
+            // arrival[j * W + i] = cost of the step from city i + 1 to city j + 1
+            arrival.assign(static_cast<size_t>(m) * W, 0);
+            for (int j = 0; j < m; j++)
+                for (int i = 0; i < m; i++)
+                    arrival[static_cast<size_t>(j) * W + i] = dist[i + 1][j + 1];
+        }
+
+        /**
+         * @brief Compute an optimal tour
+         * @return Tour length and the tour as 0, c1, ..., c(n-1)
+         */
+        std::pair<int, std::vector<int>> solve()
+        {
+            layers.assign(m + 1, {});
+            parents.assign(m + 1, {});
+
+            // Layer 1: paths 0 -> j
+            layers[1].assign(static_cast<size_t>(m) * W, UNREACHABLE);
+            for (int j = 0; j < m; j++)
+                layers[1][static_cast<size_t>(j) * W + j] = dist[0][j + 1];
+
+            for (int k = 2; k <= m; k++)
+            {
+                layers[k].resize(binom[m][k] * W);
+                if (memoryBounded)
+                    parents[k].resize(binom[m][k] * k);
+                computeLayer(k);
+
+                if (memoryBounded)
+                    std::vector<Cost>().swap(layers[k - 1]);
+            }
+
+            // Close the tour back to city 0
+            const Cost *full_row = layers[m].data();
+            long long best = std::numeric_limits<long long>::max();
+            int last = -1;
+            for (int j = 0; j < m; j++)
+            {
+                long long length = static_cast<long long>(full_row[j]) + dist[j + 1][0];
+                if (length < best)
+                {
+                    best = length;
+                    last = j;
+                }
+            }
+
+            // Walk back from the full subset, one city per layer
+            std::vector<int> path;
+            unsigned mask = m == 32 ? ~0u : (1u << m) - 1;
+            for (int k = m, j = last; k >= 1; k--)
+            {
+                path.push_back(j + 1);
+                if (k == 1)
+                    break;
+                int i = predecessor(k, mask, j);
+                mask ^= 1u << j;
+                j = i;
+            }
+            path.push_back(0);
+            std::reverse(path.begin(), path.end());
+
+            return {static_cast<int>(best), path};
+        }
+
+    private:
+        int n, m, W;
+        int numThreads;
+        bool memoryBounded;
+        const std::vector<std::vector<int>> &dist;
+        std::vector<Cost> arrival;
+        std::vector<std::vector<Cost>> layers;       // layers[k] = C(m, k) rows of W costs
+        std::vector<std::vector<uint8_t>> parents;   // parents[k][rank * k + position of end city]
+        size_t binom[32][33];
+
+        // Colexicographic rank of a subset among subsets of the same size
+        size_t rank(unsigned mask) const
+        {
+            size_t r = 0;
+            for (int i = 1; mask; i++)
+            {
+                int c = __builtin_ctz(mask);
+                r += binom[c][i];
+                mask &= mask - 1;
+            }
+            return r;
+        }
+
+        // The subset of size k with the given colexicographic rank
+        unsigned unrank(int k, size_t r) const
+        {
+            unsigned mask = 0;
+            int c = m - 1;
+            for (int i = k; i >= 1; i--)
+            {
+                while (binom[c][i] > r)
+                    c--;
+                r -= binom[c][i];
+                mask |= 1u << c;
+                c--;
+            }
+            return mask;
+        }
+
+        static unsigned nextSubset(unsigned mask)
+        {
+            // Gosper's hack: the next larger integer with the same popcount
+            unsigned lowest = mask & (~mask + 1);
+            unsigned ripple = mask + lowest;
+            return (((ripple ^ mask) >> 2) / lowest) | ripple;
+        }
+
+        // min over i of prev[i] + step[i], and the i that achieves it
+        std::pair<Cost, int> minPlus(const Cost *prev, const Cost *step, bool wantArgmin) const
+        {
+#ifdef __AVX2__
+            __m256i best = _mm256_set1_epi32(-1);
+            for (int i = 0; i < W; i += 32 / sizeof(Cost))
+            {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(prev + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(step + i));
+                if constexpr (sizeof(Cost) == 2)
+                    best = _mm256_min_epu16(best, _mm256_add_epi16(a, b));
+                else
+                    best = _mm256_min_epu32(best, _mm256_add_epi32(a, b));
+            }
+
+            __m128i low = _mm256_castsi256_si128(best);
+            __m128i high = _mm256_extracti128_si256(best, 1);
+            Cost value;
+            if constexpr (sizeof(Cost) == 2)
+            {
+                value = static_cast<Cost>(_mm_cvtsi128_si32(_mm_minpos_epu16(_mm_min_epu16(low, high))));
+            }
+            else
+            {
+                __m128i folded = _mm_min_epu32(low, high);
+                folded = _mm_min_epu32(folded, _mm_shuffle_epi32(folded, 0x4E));
+                folded = _mm_min_epu32(folded, _mm_shuffle_epi32(folded, 0xB1));
+                value = static_cast<Cost>(_mm_cvtsi128_si32(folded));
+            }
+            if (!wantArgmin)
+                return {value, -1};
+
+            __m256i target = sizeof(Cost) == 2 ? _mm256_set1_epi16(static_cast<short>(value)) : _mm256_set1_epi32(static_cast<int>(value));
+            for (int i = 0;; i += 32 / sizeof(Cost))
+            {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(prev + i));
+                __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(step + i));
+                __m256i hit = sizeof(Cost) == 2 ? _mm256_cmpeq_epi16(_mm256_add_epi16(a, b), target)
+                                                : _mm256_cmpeq_epi32(_mm256_add_epi32(a, b), target);
+                unsigned bits = _mm256_movemask_epi8(hit);
+                if (bits)
+                    return {value, i + static_cast<int>(__builtin_ctz(bits) / sizeof(Cost))};
+            }
+#else
+            Cost value = std::numeric_limits<Cost>::max();
+            if (!wantArgmin)
+            {
+                for (int i = 0; i < W; i++)
+                    value = std::min<Cost>(value, prev[i] + step[i]);
+                return {value, -1};
+            }
+
+            int argmin = -1;
+            for (int i = 0; i < W; i++)
+            {
+                Cost candidate = prev[i] + step[i];
+                if (candidate < value)
+                {
+                    value = candidate;
+                    argmin = i;
+                }
+            }
+            return {value, argmin};
+#endif
+        }
+
+        void computeLayer(int k)
+        {
+            const size_t count = binom[m][k];
+            const Cost *below = layers[k - 1].data();
+            Cost *rows = layers[k].data();
+            uint8_t *parent = memoryBounded ? parents[k].data() : nullptr;
+
+            auto work = [&](size_t begin, size_t end)
+            {
+                int members[32];
+                unsigned mask = unrank(k, begin);
+                for (size_t r = begin; r < end; r++, mask = nextSubset(mask))
+                {
+                    Cost *row = rows + r * W;
+                    std::fill(row, row + W, UNREACHABLE);
+
+                    // Rank of the subset without its t-th member:
+                    // sum_{i<t} C(c_i, i+1) + sum_{i>t} C(c_i, i)
+                    size_t below_rank = 0, above_rank = 0;
+                    int size = 0;
+                    for (unsigned rest = mask; rest; rest &= rest - 1)
+                    {
+                        members[size] = __builtin_ctz(rest);
+                        if (size > 0)
+                            above_rank += binom[members[size]][size];
+                        size++;
+                    }
+
+                    for (int t = 0; t < k; t++)
+                    {
+                        int j = members[t];
+                        const Cost *prev = below + (below_rank + above_rank) * W;
+                        auto [value, from] = minPlus(prev, &arrival[static_cast<size_t>(j) * W], parent != nullptr);
+                        row[j] = value;
+                        if (parent)
+                            parent[r * k + t] = static_cast<uint8_t>(from);
+
+                        below_rank += binom[j][t + 1];
+                        if (t + 1 < k)
+                            above_rank -= binom[members[t + 1]][t + 1];
+                    }
+                }
+            };
+
+            // Small layers are not worth the thread start-up
+            int threads = static_cast<int>(std::min<size_t>(numThreads, std::max<size_t>(1, count / 4096)));
+            std::vector<std::thread> workers;
+            for (int t = 1; t < threads; t++)
+                workers.emplace_back(work, count * t / threads, count * (t + 1) / threads);
+            work(0, count / threads);
+            for (auto &worker : workers)
+                worker.join();
+        }
+
+        // The city visited before end city j on the best path over mask (layer k)
+        int predecessor(int k, unsigned mask, int j) const
+        {
+            size_t r = rank(mask);
+            if (memoryBounded)
+            {
+                int position = std::bitset<32>(mask & ((1u << j) - 1)).count();
+                return parents[k][r * k + position];
+            }
+
+            unsigned prev_mask = mask ^ (1u << j);
+            const Cost *prev = layers[k - 1].data() + rank(prev_mask) * W;
+            return minPlus(prev, &arrival[static_cast<size_t>(j) * W], true).second;
+        }
+    };
+
+    /**
+     * @brief Solve TSP exactly with the layered, multithreaded Held-Karp engine
+     * @param dist Distance matrix (non-negative, at most 32 cities)
+     * @param numThreads Number of threads per layer (0 = hardware concurrency)
+     * @param memoryBounded Keep only two cost layers plus parent bytes
+     * @return Minimum tour length and the tour as 0, c1, ..., c(n-1)
+     */
+    std::pair<int, std::vector<int>> tspHeldKarp(const std::vector<std::vector<int>> &dist,
+                                                 int numThreads = 0, bool memoryBounded = false)
+    {
+        int n = dist.size();
+        if (n > 32)
+            throw std::invalid_argument("Held-Karp supports at most 32 cities");
+        if (numThreads <= 0)
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        if (n <= 2)
+        {
+            std::vector<int> path(n);
+            for (int i = 0; i < n; i++)
+                path[i] = i;
+            return {n == 2 ? dist[0][1] + dist[1][0] : 0, path};
+        }
+
+        long long max_dist = 0;
+        for (const auto &row : dist)
+        {
+            for (int d : row)
+            {
+                if (d < 0)
+                    throw std::invalid_argument("Held-Karp needs non-negative distances");
+                max_dist = std::max<long long>(max_dist, d);
+            }
+        }
+
+        // Any tour is at most n * max_dist; pick the narrowest cost type that holds it
+        if (n * max_dist < HeldKarp<uint16_t>::UNREACHABLE)
+            return HeldKarp<uint16_t>(dist, numThreads, memoryBounded).solve();
+        if (n * max_dist < HeldKarp<uint32_t>::UNREACHABLE)
+            return HeldKarp<uint32_t>(dist, numThreads, memoryBounded).solve();
+        throw std::invalid_argument("Distances too large for Held-Karp");
+    }
+
     /**
      * @brief Solve TSP using Nearest Neighbor heuristic (greedy approach)
      * @param dist Distance matrix
@@ -695,69 +2467,341 @@ public:
         int total_dist = 0;
         for (int i = 0; i < path.size() - 1; i++)
         {
-            total_dist += dist[path[i]][path[i + 1]];
+            total_dist += dist[path[i]][path[i + 1]];
+        }
+
+        return {total_dist, path};
+    }
+
+    /**
+     * @brief Solve TSP using 2-opt improvement heuristic
+     * @param dist Distance matrix
+     * @param initial_tour Initial tour to improve
+     * @param max_iterations Maximum number of improvement iterations
+     * @return Improved tour distance and path
+     */
+    std::pair<int, std::vector<int>> tsp2Opt(
+        const std::vector<std::vector<int>> &dist,
+        std::vector<int> initial_tour,
+        int max_iterations = 1000)
+    {
+        int n = dist.size();
+
+        // Calculate initial tour distance
+        int current_distance = 0;
+        for (int i = 0; i < n; i++)
+        {
+            current_distance += dist[initial_tour[i]][initial_tour[(i + 1) % n]];
+        }
+
+        bool improved = true;
+        int iterations = 0;
+
+        while (improved && iterations < max_iterations)
+        {
+            improved = false;
+            iterations++;
+
+            for (int i = 0; i < n - 2; i++)
+            {
+                for (int j = i + 2; j < n; j++)
+                {
+                    // Calculate the change in distance if we swap edges (i,i+1) and (j,j+1)
+                    int old_distance = dist[initial_tour[i]][initial_tour[i + 1]] +
+                                       dist[initial_tour[j]][initial_tour[(j + 1) % n]];
+                    int new_distance = dist[initial_tour[i]][initial_tour[j]] +
+                                       dist[initial_tour[i + 1]][initial_tour[(j + 1) % n]];
+
+                    if (new_distance < old_distance)
+                    {
+                        // Reverse the segment between i+1 and j
+                        std::reverse(initial_tour.begin() + i + 1, initial_tour.begin() + j + 1);
+
+                        // Update the current distance
+                        current_distance += (new_distance - old_distance);
+
+                        improved = true;
+                        break;
+                    }
+                }
+                if (improved)
+                    break;
+            }
+        }
+
+        return {current_distance, initial_tour};
+    }
+
+    /**
+     * @brief 2-opt and Or-opt local search over nearest-neighbor candidate lists
+     *
+     * Each city only considers new edges to its k nearest cities, and only while such an
+     * edge is shorter than the tour edge it would replace, so a scan stops after a few
+     * candidates. Moves are priced in O(1) from the edges they remove and add. Cities
+     * whose neighborhood gave no improvement keep a don't-look bit until a move touches
+     * them again; the others wait in a FIFO queue.
+     *
+     * The tour is an array plus the position of each city. A 2-opt move reverses the
+     * shorter side of the cycle; an Or-opt move (a segment of 1-3 cities moved elsewhere,
+     * possibly reversed) is done as two or three 2-opt moves.
+     *
+     * Assumes a symmetric distance matrix.
+     */
+    class TourLocalSearch
+    {
+    private:
+        static const int MAX_SEGMENT = 3;
+
+        const std::vector<std::vector<int>> &dist;
+        int n;
+        int k;
+        std::vector<int> candidates; // candidates[i * k + j] = j-th nearest city to i
+
+        std::vector<int> tour;     // tour[p] = city at position p
+        std::vector<int> position; // position[c] = index of city c in tour
+        std::vector<char> queued;
+        std::deque<int> active;
+
+        int next(int c) const { return tour[position[c] + 1 == n ? 0 : position[c] + 1]; }
+        int prev(int c) const { return tour[position[c] == 0 ? n - 1 : position[c] - 1]; }
+
+        // Steps from city a forward to city b
+        int forwardSteps(int a, int b) const
+        {
+            int steps = position[b] - position[a];
+            return steps < 0 ? steps + n : steps;
+        }
+
+        void activate(int c)
+        {
+            if (!queued[c])
+            {
+                queued[c] = 1;
+                active.push_back(c);
+            }
+        }
+
+        // Reverse the path from a forward to b, or the rest of the cycle if that is shorter
+        void reversePath(int a, int b)
+        {
+            int inner = forwardSteps(a, b) + 1;
+            if (2 * inner > n)
+            {
+                int outer_start = next(b);
+                b = prev(a);
+                a = outer_start;
+                inner = n - inner;
+            }
+
+            int i = position[a], j = position[b];
+            for (int swaps = inner / 2; swaps > 0; swaps--)
+            {
+                std::swap(tour[i], tour[j]);
+                position[tour[i]] = i;
+                position[tour[j]] = j;
+                i = i + 1 == n ? 0 : i + 1;
+                j = j == 0 ? n - 1 : j - 1;
+            }
+        }
+
+        // Replace edges (t1, t2), (t3, t4) - t2 after t1 and t4 after t3 in one direction - by (t1, t3), (t2, t4)
+        void twoOptMove(int t1, int t2, int t3, int t4)
+        {
+            if (next(t1) == t2)
+                reversePath(t2, t3);
+            else
+                reversePath(t1, t4);
+        }
+
+        bool tryTwoOpt(int a)
+        {
+            for (int direction = 0; direction < 2; direction++)
+            {
+                int b = direction == 0 ? next(a) : prev(a);
+                int removed = dist[a][b];
+
+                for (int j = 0; j < k; j++)
+                {
+                    int c = candidates[static_cast<size_t>(a) * k + j];
+                    if (dist[a][c] >= removed)
+                        break;
+
+                    int d = direction == 0 ? next(c) : prev(c);
+                    if (c == b || d == a)
+                        continue;
+
+                    if (dist[a][c] + dist[b][d] < removed + dist[c][d])
+                    {
+                        twoOptMove(a, b, c, d);
+                        for (int city : {a, b, c, d})
+                            activate(city);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        // Move first..last (tour order) between x and y = next(x)
+        void moveSegment(int first, int last, int x, int y, bool reversed)
+        {
+            int before = prev(first), after = next(last);
+
+            // before [first..last] after ... x y  ->  before x ... after [last..first] y
+            twoOptMove(before, first, x, y);
+            // -> before after ... x [last..first] y
+            if (x != after)
+                twoOptMove(before, x, after, last);
+            // -> x [first..last] y
+            if (!reversed && first != last)
+                twoOptMove(x, last, first, y);
         }
 
-        return {total_dist, path};
-    }
+        bool tryOrOpt(int a)
+        {
+            for (int length = 1; length <= MAX_SEGMENT && length < n - 2; length++)
+            {
+                for (int direction = 0; direction < (length == 1 ? 1 : 2); direction++)
+                {
+                    // Segment with a at one end
+                    int first = a, last = a;
+                    for (int step = 1; step < length; step++)
+                    {
+                        if (direction == 0)
+                            last = next(last);
+                        else
+                            first = prev(first);
+                    }
+                    int before = prev(first), after = next(last);
+                    int removal_gain = dist[before][first] + dist[last][after] - dist[before][after];
+                    int other = a == first ? last : first;
 
-    /**
-     * @brief Solve TSP using 2-opt improvement heuristic
-     * @param dist Distance matrix
-     * @param initial_tour Initial tour to improve
-     * @param max_iterations Maximum number of improvement iterations
-     * @return Improved tour distance and path
-     */
-    std::pair<int, std::vector<int>> tsp2Opt(
-        const std::vector<std::vector<int>> &dist,
-        std::vector<int> initial_tour,
-        int max_iterations = 1000)
-    {
-        int n = dist.size();
+                    for (int j = 0; j < k; j++)
+                    {
+                        int c = candidates[static_cast<size_t>(a) * k + j];
+                        if (dist[a][c] >= removal_gain)
+                            break;
+                        if (forwardSteps(first, c) < length)
+                            continue;
 
-        // Calculate initial tour distance
-        int current_distance = 0;
-        for (int i = 0; i < n; i++)
-        {
-            current_distance += dist[initial_tour[i]][initial_tour[(i + 1) % n]];
+                        // Put a next to c, after it or before it
+                        for (int side = 0; side < 2; side++)
+                        {
+                            int x = side == 0 ? c : prev(c);
+                            int y = side == 0 ? next(c) : c;
+                            if (x == last || y == first || y == before)
+                                continue;
+
+                            int near_x = side == 0 ? a : other;
+                            int near_y = side == 0 ? other : a;
+                            if (dist[x][near_x] + dist[near_y][y] - dist[x][y] < removal_gain)
+                            {
+                                moveSegment(first, last, x, y, near_x != first);
+                                for (int city : {before, after, first, last, x, y})
+                                    activate(city);
+                                return true;
+                            }
+                        }
+                    }
+                }
+            }
+            return false;
         }
 
-        bool improved = true;
-        int iterations = 0;
+    public:
+        /**
+         * @brief Build the candidate lists
+         * @param dist Symmetric distance matrix
+         * @param k Number of candidate neighbors per city
+         */
+        TourLocalSearch(const std::vector<std::vector<int>> &dist, int k)
+            : dist(dist), n(dist.size()), k(std::max(0, std::min<int>(k, dist.size() - 1)))
+        {
+            candidates.resize(static_cast<size_t>(n) * this->k);
+            std::vector<int> order(n);
+            for (int i = 0; i < n; i++)
+            {
+                for (int j = 0; j < n; j++)
+                    order[j] = j;
+                std::swap(order[i], order[n - 1]);
+
+                auto closer = [&](int a, int b)
+                { return dist[i][a] < dist[i][b]; };
+                std::nth_element(order.begin(), order.begin() + this->k, order.end() - 1, closer);
+                std::sort(order.begin(), order.begin() + this->k, closer);
+                std::copy(order.begin(), order.begin() + this->k, candidates.begin() + static_cast<size_t>(i) * this->k);
+            }
+        }
 
-        while (improved && iterations < max_iterations)
+        /**
+         * @brief Improve a tour until no candidate move helps
+         * @param route Order of the cities (each once); improved in place
+         * @param use_or_opt Also try Or-opt segment moves
+         * @return Length of the improved tour
+         */
+        int improve(std::vector<int> &route, bool use_or_opt = true)
         {
-            improved = false;
-            iterations++;
+            tour = route;
+            position.assign(n, 0);
+            for (int p = 0; p < n; p++)
+                position[tour[p]] = p;
 
-            for (int i = 0; i < n - 2; i++)
+            if (n >= 5)
             {
-                for (int j = i + 2; j < n; j++)
+                queued.assign(n, 0);
+                active.clear();
+                for (int city : tour)
+                    activate(city);
+
+                while (!active.empty())
                 {
-                    // Calculate the change in distance if we swap edges (i,i+1) and (j,j+1)
-                    int old_distance = dist[initial_tour[i]][initial_tour[i + 1]] +
-                                       dist[initial_tour[j]][initial_tour[(j + 1) % n]];
-                    int new_distance = dist[initial_tour[i]][initial_tour[j]] +
-                                       dist[initial_tour[i + 1]][initial_tour[(j + 1) % n]];
+                    int a = active.front();
+                    active.pop_front();
+                    queued[a] = 0;
 
-                    if (new_distance < old_distance)
+                    // Stay on a while it keeps improving
+                    while (tryTwoOpt(a) || (use_or_opt && tryOrOpt(a)))
                     {
-                        // Reverse the segment between i+1 and j
-                        std::reverse(initial_tour.begin() + i + 1, initial_tour.begin() + j + 1);
-
-                        // Update the current distance
-                        current_distance += (new_distance - old_distance);
-
-                        improved = true;
-                        break;
                     }
                 }
-                if (improved)
-                    break;
             }
+
+            route = tour;
+            int length = 0;
+            for (int p = 0; p < n; p++)
+                length += dist[route[p]][route[(p + 1) % n]];
+            return length;
         }
+    };
 
-        return {current_distance, initial_tour};
+    /**
+     * @brief Improve a TSP tour with 2-opt and Or-opt moves between nearest neighbors
+     * @param dist Symmetric distance matrix
+     * @param initial_tour Tour to improve (a trailing copy of the first city is allowed)
+     * @param k Number of candidate neighbors per city
+     * @param use_or_opt Also try Or-opt segment moves
+     * @return Improved tour distance and path, in the same format and from the same start as the input
+     */
+    std::pair<int, std::vector<int>> tspLocalSearch(
+        const std::vector<std::vector<int>> &dist,
+        std::vector<int> initial_tour,
+        int k = 10,
+        bool use_or_opt = true)
+    {
+        bool closed = initial_tour.size() > 1 && initial_tour.front() == initial_tour.back();
+        if (closed)
+            initial_tour.pop_back();
+        if (initial_tour.empty())
+            return {0, initial_tour};
+
+        int start = initial_tour[0];
+        TourLocalSearch search(dist, k);
+        int length = search.improve(initial_tour, use_or_opt);
+
+        std::rotate(initial_tour.begin(), std::find(initial_tour.begin(), initial_tour.end(), start), initial_tour.end());
+        if (closed)
+            initial_tour.push_back(start);
+        return {length, initial_tour};
     }
 };
 
@@ -871,6 +2915,171 @@ public:
         return cost;
     }
 
+    /**
+     * @brief Generate a layered flow network: source -> layer 0 -> ... -> last layer -> sink
+     * @param layers Number of layers
+     * @param width Vertices per layer
+     * @param degree Edges from each vertex to the next layer
+     * @param max_capacity Maximum capacity of any edge
+     * @return Edges (from, to, capacity); vertex layers * width is the source, the one after it the sink
+     */
+    static std::vector<std::tuple<int, int, int>> generateLayeredNetwork(
+        int layers, int width, int degree, int max_capacity = 100)
+    {
+        std::vector<std::tuple<int, int, int>> edges;
+        int source = layers * width, sink = source + 1;
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> cap_dis(1, max_capacity);
+        std::uniform_int_distribution<> start_dis(0, width - 1);
+
+        for (int i = 0; i < width; i++)
+        {
+            edges.emplace_back(source, i, cap_dis(gen));
+            edges.emplace_back((layers - 1) * width + i, sink, cap_dis(gen));
+        }
+        for (int l = 0; l + 1 < layers; l++)
+        {
+            for (int i = 0; i < width; i++)
+            {
+                // Consecutive targets from a random start, so no edge repeats
+                int start = start_dis(gen);
+                for (int k = 0; k < std::min(degree, width); k++)
+                {
+                    edges.emplace_back(l * width + i, (l + 1) * width + (start + k) % width, cap_dis(gen));
+                }
+            }
+        }
+
+        return edges;
+    }
+
+    /**
+     * @brief Generate a grid flow network with edges in all four directions
+     * @param rows Number of rows
+     * @param cols Number of columns
+     * @param max_capacity Maximum capacity of any grid edge
+     * @return Edges (from, to, capacity); the source (rows * cols) feeds the left column,
+     *         the sink (rows * cols + 1) drains the right column
+     */
+    static std::vector<std::tuple<int, int, int>> generateGridNetwork(
+        int rows, int cols, int max_capacity = 100)
+    {
+        std::vector<std::tuple<int, int, int>> edges;
+        int source = rows * cols, sink = source + 1;
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> cap_dis(1, max_capacity);
+
+        for (int r = 0; r < rows; r++)
+        {
+            edges.emplace_back(source, r * cols, cap_dis(gen) * 10);
+            edges.emplace_back(r * cols + cols - 1, sink, cap_dis(gen) * 10);
+            for (int c = 0; c < cols; c++)
+            {
+                int v = r * cols + c;
+                if (c + 1 < cols)
+                {
+                    edges.emplace_back(v, v + 1, cap_dis(gen));
+                    edges.emplace_back(v + 1, v, cap_dis(gen));
+                }
+                if (r + 1 < rows)
+                {
+                    edges.emplace_back(v, v + cols, cap_dis(gen));
+                    edges.emplace_back(v + cols, v, cap_dis(gen));
+                }
+            }
+        }
+
+        return edges;
+    }
+
+    /**
+     * @brief Generate a random bipartite capacity network (supply -> links -> demand)
+     * @param n Number of vertices in the first partition
+     * @param m Number of vertices in the second partition
+     * @param degree Edges from each first-partition vertex
+     * @param max_capacity Maximum capacity of any edge
+     * @return Edges (from, to, capacity); vertex n + m is the source, n + m + 1 the sink
+     */
+    static std::vector<std::tuple<int, int, int>> generateBipartiteNetwork(
+        int n, int m, int degree, int max_capacity = 10)
+    {
+        std::vector<std::tuple<int, int, int>> edges;
+        int source = n + m, sink = source + 1;
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> cap_dis(1, max_capacity);
+        std::uniform_int_distribution<> start_dis(0, m - 1);
+        std::uniform_int_distribution<> step_dis(1, std::max(1, m / std::max(1, degree)));
+
+        for (int i = 0; i < n; i++)
+        {
+            edges.emplace_back(source, i, cap_dis(gen));
+
+            // Evenly spaced targets from a random start, so no edge repeats
+            int start = start_dis(gen), step = step_dis(gen);
+            for (int k = 0; k < std::min(degree, m); k++)
+            {
+                edges.emplace_back(i, n + (start + k * step) % m, cap_dis(gen));
+            }
+        }
+        for (int j = 0; j < m; j++)
+        {
+            edges.emplace_back(n + j, sink, cap_dis(gen));
+        }
+
+        return edges;
+    }
+
+    /**
+     * @brief Generate a road network for min-cost flow: a grid of two-way roads with
+     *        capacities (cars per minute) and costs (travel time)
+     * @param rows Number of rows of intersections
+     * @param cols Number of columns of intersections
+     * @param max_capacity Maximum capacity of a road
+     * @param max_cost Maximum travel time of a road
+     * @return Edges (from, to, capacity, cost); the source (rows * cols) is the residential
+     *         area feeding the left column, the sink (rows * cols + 1) the industrial area
+     *         behind the right column
+     */
+    static std::vector<std::tuple<int, int, int, int>> generateTrafficNetwork(
+        int rows, int cols, int max_capacity = 1000, int max_cost = 20)
+    {
+        std::vector<std::tuple<int, int, int, int>> edges;
+        int source = rows * cols, sink = source + 1;
+
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> cap_dis(1, max_capacity);
+        std::uniform_int_distribution<> cost_dis(1, max_cost);
+
+        for (int r = 0; r < rows; r++)
+        {
+            edges.emplace_back(source, r * cols, 2 * max_capacity, 0);
+            edges.emplace_back(r * cols + cols - 1, sink, 2 * max_capacity, 0);
+            for (int c = 0; c < cols; c++)
+            {
+                int v = r * cols + c;
+                if (c + 1 < cols)
+                {
+                    edges.emplace_back(v, v + 1, cap_dis(gen), cost_dis(gen));
+                    edges.emplace_back(v + 1, v, cap_dis(gen), cost_dis(gen));
+                }
+                if (r + 1 < rows)
+                {
+                    edges.emplace_back(v, v + cols, cap_dis(gen), cost_dis(gen));
+                    edges.emplace_back(v + cols, v, cap_dis(gen), cost_dis(gen));
+                }
+            }
+        }
+
+        return edges;
+    }
+
     /**
      * @brief Create a symmetric distance matrix for TSP
      * @param n Number of cities
@@ -997,9 +3206,9 @@ public:
         std::vector<std::tuple<std::string, std::string, int>> bottlenecks;
 
         // A simple way to find bottlenecks is to look for edges that are at capacity
-        for (int i = 0; i < network.edges.size(); i += 2)
+        for (size_t i = 0; i < network.getEdges().size(); i += 2)
         { // Skip backward edges
-            auto &e = network.edges[i];
+            auto &e = network.getEdges()[i];
             if (e.flow == e.cap && e.cap > 0)
             {
                 bottlenecks.emplace_back(locations[e.from], locations[e.to], e.cap);
@@ -1056,6 +3265,7 @@ private:
     std::vector<std::string> workers;
     std::vector<std::string> jobs;
     std::vector<std::vector<int>> costs;
+    std::vector<int> assignment; // Cached optimal assignment (computed on first use)
 
 public:
     /**
@@ -1077,8 +3287,13 @@ public:
     std::pair<int, std::vector<std::pair<std::string, std::string>>>
     findOptimalAssignment()
     {
-        GraphAlgorithms algo;
-        auto assignments = algo.hungarianAlgorithm(costs);
+        // Lower cost = better, so solve the minimum-cost assignment once and reuse it
+        if (assignment.empty())
+        {
+            GraphAlgorithms algo;
+            assignment = algo.minCostAssignment(costs);
+        }
+        const std::vector<int> &assignments = assignment;
 
         // Calculate the total cost
         int total_cost = 0;
@@ -1334,9 +3549,13 @@ public:
 
 /**
  * @brief Main demonstration function
+ *
+ * Pass --large to also run the million-vertex and multi-gigabyte benchmarks.
  */
-int main()
+int main(int argc, char *argv[])
 {
+    bool runLarge = argc > 1 && std::string(argv[1]) == "--large";
+
     // Set up console output formatting
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "========================\n";
@@ -1513,14 +3732,14 @@ int main()
     };
 
     JobAssignmentOptimization jobAssign(workers, jobs, skillCosts);
-    auto [total_cost, assignments_pairs] = jobAssign.findOptimalAssignment();
+    auto [assignment_cost, assignments_pairs] = jobAssign.findOptimalAssignment();
 
     std::cout << "Optimal job assignments (lower cost = better skill):\n";
     for (const auto &[worker, job] : assignments_pairs)
     {
         std::cout << worker << " assigned to " << job << "\n";
     }
-    std::cout << "Total cost: " << total_cost << "\n\n";
+    std::cout << "Total cost: " << assignment_cost << "\n\n";
 
     auto [best_job, cost] = jobAssign.findBestJobForWorker("Alice");
     std::cout << "Best job for Alice: " << best_job << " (Cost: " << cost << ")\n\n";
@@ -1617,6 +3836,203 @@ int main()
         std::cout << "Speedup: " << ff_time / dinic_time << "x\n";
     }
 
+    // Compare Dinic's algorithm and push-relabel on large sparse networks
+    std::cout << "\nComparing Dinic's algorithm and push-relabel on large networks:\n";
+
+    struct LargeNetwork
+    {
+        std::string name;
+        int n;
+        std::vector<std::tuple<int, int, int>> edges;
+    };
+    // Dinic's algorithm takes several seconds on each 200-wide network
+    int large_side = runLarge ? 200 : 100;
+    std::string side_label = std::to_string(large_side);
+    std::vector<LargeNetwork> large_networks = {
+        {"Layered (" + side_label + " x 1000)", large_side * 1000 + 2, BenchmarkUtils::generateLayeredNetwork(large_side, 1000, 4)},
+        {"Grid (" + side_label + " x " + side_label + ")", large_side * large_side + 2, BenchmarkUtils::generateGridNetwork(large_side, large_side)}};
+    if (runLarge)
+    {
+        large_networks.push_back({"Bipartite (500k + 500k)", 1000000 + 2, BenchmarkUtils::generateBipartiteNetwork(500000, 500000, 4)});
+    }
+
+    for (const auto &[name, n, edges] : large_networks)
+    {
+        GraphAlgorithms::FlowNetwork dinic_network(n);
+        GraphAlgorithms::FlowNetwork pr_network(n);
+        GraphAlgorithms::FlowNetwork parallel_network(n);
+        for (const auto &[from, to, cap] : edges)
+        {
+            dinic_network.addEdge(from, to, cap);
+            pr_network.addEdge(from, to, cap);
+            parallel_network.addEdge(from, to, cap);
+        }
+
+        int dinic_flow = 0, pr_flow = 0, parallel_flow = 0;
+        double dinic_time = BenchmarkUtils::measureTime([&]()
+                                                        { dinic_flow = dinic_network.dinicMaxFlow(n - 2, n - 1); });
+        double pr_time = BenchmarkUtils::measureTime([&]()
+                                                     { pr_flow = pr_network.pushRelabelMaxFlow(n - 2, n - 1); });
+        double parallel_time = BenchmarkUtils::measureTime([&]()
+                                                           { parallel_flow = parallel_network.pushRelabelMaxFlow(n - 2, n - 1, true); });
+
+        std::cout << "\n"
+                  << name << ", " << edges.size() << " edges:\n";
+        std::cout << "Dinic's algorithm: " << dinic_time << " ms (flow " << dinic_flow << ")\n";
+        std::cout << "Push-relabel: " << pr_time << " ms (flow " << pr_flow << ")\n";
+        std::cout << "Push-relabel, parallel global relabel: " << parallel_time << " ms (flow " << parallel_flow << ")\n";
+        std::cout << "Same result: " << (dinic_flow == pr_flow && pr_flow == parallel_flow ? "Yes" : "No") << "\n";
+    }
+
+    // Compare matching and assignment algorithms at scale
+    std::cout << "\nComparing bipartite matching algorithms:\n";
+
+    for (int size : {500, 10000})
+    {
+        auto bipartite = BenchmarkUtils::generateRandomBipartite(size, size, 4.0 / size);
+
+        // CSR adjacency for Hopcroft-Karp
+        std::vector<int> offsets(size + 1, 0), adjacency;
+        for (int i = 0; i < size; i++)
+        {
+            for (int j = 0; j < size; j++)
+            {
+                if (bipartite[i][j])
+                    adjacency.push_back(j);
+            }
+            offsets[i + 1] = adjacency.size();
+        }
+
+        std::cout << "\n"
+                  << size << " x " << size << " workers/jobs, " << adjacency.size() << " edges:\n";
+
+        int hk_matches = 0;
+        double hk_time = BenchmarkUtils::measureTime([&]()
+                                                     { hk_matches = algo.hopcroftKarp(size, size, offsets, adjacency).first; });
+
+        // The flow-based version scans the full matrix per edge to extract the matching
+        if (size <= 1000)
+        {
+            int flow_matches = 0;
+            double flow_time = BenchmarkUtils::measureTime([&]()
+                                                           { flow_matches = algo.maxBipartiteMatching(bipartite).first; });
+            std::cout << "Flow-based matching: " << flow_time << " ms (" << flow_matches << " matches)\n";
+            std::cout << "Same result: " << (flow_matches == hk_matches ? "Yes" : "No") << "\n";
+        }
+        std::cout << "Hopcroft-Karp (CSR): " << hk_time << " ms (" << hk_matches << " matches)\n";
+    }
+
+    std::cout << "\nComparing assignment algorithms:\n";
+
+    // The 10000 x 10000 cost matrix alone is 400 MB
+    std::vector<int> assignment_sizes = {1000};
+    if (runLarge)
+    {
+        assignment_sizes.push_back(10000);
+    }
+
+    for (int size : assignment_sizes)
+    {
+        auto cost_matrix = BenchmarkUtils::generateRandomCostMatrix(size, size, 10000);
+        std::vector<int> flat_costs;
+        flat_costs.reserve(static_cast<size_t>(size) * size);
+        for (const auto &row : cost_matrix)
+        {
+            flat_costs.insert(flat_costs.end(), row.begin(), row.end());
+        }
+
+        auto assignmentCost = [&](const std::vector<int> &assignment)
+        {
+            long long total = 0;
+            for (int i = 0; i < size; i++)
+                total += cost_matrix[i][assignment[i]];
+            return total;
+        };
+
+        std::cout << "\n"
+                  << size << " x " << size << " cost matrix:\n";
+
+        std::vector<int> lap_assignment;
+        double lap_time = BenchmarkUtils::measureTime([&]()
+                                                      { lap_assignment = algo.lapjv(flat_costs, size); });
+        long long lap_cost = assignmentCost(lap_assignment);
+
+        // hungarianAlgorithm maximizes, so give it negated costs
+        if (size <= 1000)
+        {
+            std::vector<std::vector<int>> negated = cost_matrix;
+            for (auto &row : negated)
+                for (int &c : row)
+                    c = -c;
+
+            std::vector<int> hungarian_assignment;
+            double hungarian_time = BenchmarkUtils::measureTime([&]()
+                                                                { hungarian_assignment = algo.hungarianAlgorithm(negated); });
+            long long hungarian_cost = assignmentCost(hungarian_assignment);
+            std::cout << "Hungarian (dense): " << hungarian_time << " ms (cost " << hungarian_cost << ")"
+                      << (hungarian_cost == lap_cost ? "" : " MISMATCH") << "\n";
+        }
+
+        std::cout << "LAPJV: " << lap_time << " ms (cost " << lap_cost << ")\n";
+
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned t : {1u, threads})
+        {
+            std::vector<int> auction_assignment;
+            double auction_time = BenchmarkUtils::measureTime([&]()
+                                                              { auction_assignment = algo.auctionAssignment(flat_costs, size, t); });
+            long long auction_cost = assignmentCost(auction_assignment);
+            std::cout << "Auction (" << t << " thread" << (t == 1 ? "" : "s") << "): " << auction_time
+                      << " ms (cost " << auction_cost << ")" << (auction_cost == lap_cost ? "" : " MISMATCH") << "\n";
+            if (threads == 1)
+                break;
+        }
+    }
+
+    // Compare min-cost flow algorithms on traffic networks with large flow values
+    std::cout << "\nComparing min-cost max-flow algorithms on traffic networks:\n";
+
+    std::vector<int> traffic_sides = {15, 40};
+    if (runLarge)
+    {
+        traffic_sides.push_back(150);
+    }
+
+    for (int side : traffic_sides)
+    {
+        auto roads = BenchmarkUtils::generateTrafficNetwork(side, side);
+        int n = side * side + 2;
+        std::cout << "\nTraffic grid " << side << " x " << side << ", " << roads.size() << " roads:\n";
+
+        std::vector<std::pair<GraphAlgorithms::MinCostAlgorithm, std::string>> methods = {
+            {GraphAlgorithms::MinCostAlgorithm::CapacityScaling, "Dijkstra + capacity scaling"},
+            {GraphAlgorithms::MinCostAlgorithm::CostScaling, "Cost scaling"}};
+        // SPFA needs one Bellman-Ford run per augmenting path; skip it on the large grid
+        if (side <= 40)
+        {
+            methods.insert(methods.begin(), {GraphAlgorithms::MinCostAlgorithm::SPFA, "SPFA successive shortest paths"});
+        }
+
+        std::pair<int, int> reference;
+        for (size_t i = 0; i < methods.size(); i++)
+        {
+            GraphAlgorithms::FlowNetwork traffic_network(n);
+            for (const auto &[from, to, cap, cost] : roads)
+            {
+                traffic_network.addEdge(from, to, cap, cost);
+            }
+
+            std::pair<int, int> result;
+            double time = BenchmarkUtils::measureTime([&]()
+                                                      { result = traffic_network.minCostMaxFlow(n - 2, n - 1, methods[i].first); });
+            if (i == 0)
+                reference = result;
+
+            std::cout << methods[i].second << ": " << time << " ms (flow " << result.first
+                      << ", cost " << result.second << ")" << (result == reference ? "" : " MISMATCH") << "\n";
+        }
+    }
+
     std::cout << "\nComparing TSP algorithms on random instance:\n";
 
     // Generate a random TSP instance
@@ -1636,12 +4052,87 @@ int main()
     auto [dp_opt, _] = algo.tspDP(tsp_instance);
     auto [nn_opt, nn_p] = algo.tspNearestNeighbor(tsp_instance);
     auto [opt_2_opt, _2] = algo.tsp2Opt(tsp_instance, nn_p);
+    auto [opt_local, _3] = algo.tspLocalSearch(tsp_instance, nn_p);
 
     std::cout << "DP solution (optimal): " << dp_opt << "\n";
     std::cout << "Nearest Neighbor solution: " << nn_opt
               << " (error: " << (nn_opt - dp_opt) * 100.0 / dp_opt << "%)\n";
     std::cout << "2-opt improved solution: " << opt_2_opt
               << " (error: " << (opt_2_opt - dp_opt) * 100.0 / dp_opt << "%)\n";
+    std::cout << "2-opt / Or-opt local search solution: " << opt_local
+              << " (error: " << (opt_local - dp_opt) * 100.0 / dp_opt << "%)\n";
+
+    std::cout << "\nComparing TSP heuristics on larger instances:\n";
+
+    for (int cities : {1000, 2000, 5000})
+    {
+        auto instance = BenchmarkUtils::generateTSPInstance(cities);
+        std::cout << "\n"
+                  << cities << " cities:\n";
+
+        std::pair<int, std::vector<int>> greedy;
+        double greedy_time = BenchmarkUtils::measureTime([&]()
+                                                         { greedy = algo.tspNearestNeighbor(instance); });
+        std::cout << "Nearest Neighbor: " << greedy_time << " ms (tour " << greedy.first << ")\n";
+
+        // tsp2Opt rescans all pairs after every move
+        if (cities <= 1000)
+        {
+            int length = 0;
+            double time = BenchmarkUtils::measureTime([&]()
+                                                      { length = algo.tsp2Opt(instance, greedy.second).first; });
+            std::cout << "  + 2-opt (all pairs): " << time << " ms (tour " << length << ")\n";
+        }
+
+        for (bool or_opt : {false, true})
+        {
+            int length = 0;
+            double time = BenchmarkUtils::measureTime([&]()
+                                                      { length = algo.tspLocalSearch(instance, greedy.second, 10, or_opt).first; });
+            std::cout << (or_opt ? "  + 2-opt / Or-opt (neighbor lists): " : "  + 2-opt (neighbor lists): ")
+                      << time << " ms (tour " << length << ")\n";
+        }
+    }
+
+    std::cout << "\nComparing exact TSP solvers (Held-Karp):\n";
+
+    // The full DP table at 26 cities is about 0.9 GB
+    std::vector<int> held_karp_sizes = {16, 20};
+    if (runLarge)
+    {
+        held_karp_sizes.insert(held_karp_sizes.end(), {24, 26});
+    }
+
+    for (int cities : held_karp_sizes)
+    {
+        auto instance = BenchmarkUtils::generateTSPInstance(cities);
+        std::cout << "\n"
+                  << cities << " cities:\n";
+
+        // The nested-vector DP needs 2^n * n ints twice over
+        int reference = -1;
+        if (cities <= 20)
+        {
+            double old_time = BenchmarkUtils::measureTime([&]()
+                                                          { reference = algo.tspDP(instance).first; });
+            std::cout << "Nested-vector DP: " << old_time << " ms (tour " << reference << ")\n";
+        }
+
+        // Full mode keeps every layer: 2^(n-1) rows of 32 or 64 bytes
+        for (bool bounded : {false, true})
+        {
+            if (!bounded && cities > 24)
+                continue;
+
+            std::pair<int, std::vector<int>> result;
+            double time = BenchmarkUtils::measureTime([&]()
+                                                      { result = algo.tspHeldKarp(instance, 0, bounded); });
+            std::cout << (bounded ? "Held-Karp (two layers + parents): " : "Held-Karp (all layers): ") << time
+                      << " ms (tour " << result.first << ")"
+                      << (reference != -1 && result.first != reference ? " MISMATCH" : "") << "\n";
+            reference = result.first;
+        }
+    }
 
     std::cout << "\n==========================\n";
     std::cout << "End of Graph Problems Demo\n";
@@ -72,7 +72,9 @@ namespace MST
     // Prim's and Kruskal's algorithms are greedy approaches for MST
     struct Edge;
     vector<Edge> kruskalMST(vector<Edge> &edges, int V);
+    vector<Edge> filterKruskalMST(vector<Edge> &edges, int V);
     void runDemo();
+    void runBenchmark(int size);
 }
 
 // Utility functions
@@ -130,6 +132,7 @@ int main()
             FractionalKnapsack::runBenchmark(1000);
             HuffmanCoding::runBenchmark(10000);
             CoinChange::compareApproaches();
+            MST::runBenchmark(100000);
             break;
         case 0:
             cout << "Exiting program. Thank you for exploring greedy algorithms!" << endl;
@@ -1456,14 +1459,16 @@ namespace MST
             }
         }
 
-        // Find the parent of a vertex (with path compression)
+        // Find the root of a vertex (iterative path splitting, so deep trees cannot overflow the stack)
         int find(int x)
         {
-            if (parent[x] != x)
+            while (parent[x] != x)
             {
-                parent[x] = find(parent[x]);
+                int next = parent[x];
+                parent[x] = parent[next];
+                x = next;
             }
-            return parent[x];
+            return x;
         }
 
         // Union by rank
@@ -1526,6 +1531,123 @@ namespace MST
         return result;
     }
 
+    // Edge ranges at or below this size are simply sorted
+    const size_t FILTER_KRUSKAL_BASE_SIZE = 1024;
+
+    /**
+     * @brief Recursive step of filter-Kruskal on edges [first, last)
+     */
+    void filterKruskal(vector<Edge>::iterator first, vector<Edge>::iterator last,
+                       DisjointSet &ds, vector<Edge> &result, int V)
+    {
+        if (first == last || static_cast<int>(result.size()) >= V - 1)
+            return;
+
+        size_t size = last - first;
+        auto middle = last;
+
+        if (size > FILTER_KRUSKAL_BASE_SIZE)
+        {
+            // Median of three samples as pivot, then split into light and heavy edges
+            int a = first[size / 4].weight, b = first[size / 2].weight, c = first[3 * size / 4].weight;
+            int pivot = max(min(a, b), min(max(a, b), c));
+            middle = partition(first, last, [pivot](const Edge &edge)
+                               { return edge.weight <= pivot; });
+        }
+
+        if (middle == last)
+        {
+            // Small range, or the pivot was the maximum weight: plain Kruskal
+            sort(first, last);
+            for (auto it = first; it != last && static_cast<int>(result.size()) < V - 1; ++it)
+            {
+                int rootSrc = ds.find(it->src);
+                int rootDest = ds.find(it->dest);
+                if (rootSrc != rootDest)
+                {
+                    result.push_back(*it);
+                    ds.unionSets(rootSrc, rootDest);
+                }
+            }
+            return;
+        }
+
+        filterKruskal(first, middle, ds, result, V);
+
+        // Drop heavy edges that would close a cycle before looking at them again
+        auto kept = remove_if(middle, last, [&ds](const Edge &edge)
+                              { return ds.find(edge.src) == ds.find(edge.dest); });
+        filterKruskal(middle, kept, ds, result, V);
+    }
+
+    /**
+     * @brief Filter-Kruskal algorithm for finding MST
+     *
+     * Partitions the edges around a pivot weight like quicksort, solves the light half
+     * first and then discards every heavy edge whose endpoints are already connected.
+     * On graphs with many more edges than vertices most edges are never sorted.
+     *
+     * @param edges Vector of edges (reordered in place)
+     * @param V Number of vertices
+     * @return Vector of edges in the MST
+     * @time_complexity O(E + V log V log(E/V)) expected for random weights, O(E log E) worst case
+     * @space_complexity O(E + V) for storing edges and disjoint set
+     */
+    vector<Edge> filterKruskalMST(vector<Edge> &edges, int V)
+    {
+        vector<Edge> result;
+        DisjointSet ds(V);
+        filterKruskal(edges.begin(), edges.end(), ds, result, V);
+        return result;
+    }
+
+    /**
+     * @brief Benchmark Kruskal against filter-Kruskal on a sparse random graph
+     * @param size Number of vertices (the graph has 10 edges per vertex)
+     */
+    void runBenchmark(int size)
+    {
+        printHeader("MINIMUM SPANNING TREE BENCHMARK");
+
+        // Seed for reproducibility
+        srand(42);
+
+        vector<Edge> edges;
+        for (int i = 1; i < size; i++)
+        {
+            // A random spanning path keeps the graph connected
+            edges.push_back(Edge(rand() % i, i, 1 + rand() % 1000000));
+        }
+        for (long long i = 0; i < 9LL * size; i++)
+        {
+            edges.push_back(Edge(rand() % size, rand() % size, 1 + rand() % 1000000));
+        }
+
+        cout << "Benchmarking MST with " << size << " vertices and " << edges.size() << " edges..." << endl;
+
+        vector<Edge> kruskalEdges = edges;
+        auto startTime = high_resolution_clock::now();
+        vector<Edge> kruskalResult = kruskalMST(kruskalEdges, size);
+        auto endTime = high_resolution_clock::now();
+        auto kruskalDuration = duration_cast<microseconds>(endTime - startTime);
+
+        vector<Edge> filterEdges = edges;
+        startTime = high_resolution_clock::now();
+        vector<Edge> filterResult = filterKruskalMST(filterEdges, size);
+        endTime = high_resolution_clock::now();
+        auto filterDuration = duration_cast<microseconds>(endTime - startTime);
+
+        long long kruskalWeight = 0, filterWeight = 0;
+        for (const auto &edge : kruskalResult)
+            kruskalWeight += edge.weight;
+        for (const auto &edge : filterResult)
+            filterWeight += edge.weight;
+
+        cout << "Kruskal:        " << kruskalDuration.count() / 1000.0 << " milliseconds (weight " << kruskalWeight << ")" << endl;
+        cout << "Filter-Kruskal: " << filterDuration.count() / 1000.0 << " milliseconds (weight " << filterWeight << ")" << endl;
+        cout << "Same MST weight: " << (kruskalWeight == filterWeight ? "Yes" : "No") << endl;
+    }
+
     /**
      * @brief Demonstration of the MST algorithms
      */
@@ -1140,6 +1140,510 @@ namespace RouteOptimization
         return best;
     }
 
+    // 2-opt / Or-opt local search over nearest-neighbor candidate lists
+    //
+    // The depot and the route's stops form a cycle. Each stop only tries new edges to its
+    // k nearest stops, and only while such an edge is shorter than the route edge it
+    // replaces; every move is priced in O(1) from the edges it removes and adds. Stops
+    // that yielded nothing keep a don't-look bit until a move touches them again.
+    //
+    // The cycle is an array with the position of each stop. A 2-opt move reverses one
+    // side of the cycle in place; an Or-opt move (1-3 stops moved elsewhere, possibly
+    // reversed) is done as two or three 2-opt moves, or as a rotation of the stops in
+    // between when the depot must stay first.
+    //
+    // With time windows on, the route keeps its direction out of the depot (only the
+    // side without the depot is ever reversed) and a move is kept only if the schedule
+    // stays feasible. ScheduleSegment summaries of every route prefix and suffix are
+    // cached, so a check only walks the stops whose order changes; the cache is rebuilt
+    // after each applied move. Time windows are only enforced if the starting route
+    // already meets them.
+    class RouteLocalSearch
+    {
+    public:
+        RouteLocalSearch(const std::vector<Location> &locations, int k = 10, bool useTimeWindows = true)
+            : locations(locations), k(k), useTimeWindows(useTimeWindows) {}
+
+        // Improve the route (stop ids, depot excluded) in place and return its distance
+        double improve(std::vector<int> &route)
+        {
+            n = route.size() + 1;
+            ids.assign(1, 0);
+            ids.insert(ids.end(), route.begin(), route.end());
+
+            tour.resize(n);
+            position.resize(n);
+            for (int i = 0; i < n; i++)
+            {
+                tour[i] = i;
+                position[i] = i;
+            }
+
+            if (n >= 5)
+            {
+                buildCandidates();
+                checkTimeWindows = useTimeWindows && scheduleFeasible();
+
+                queued.assign(n, 0);
+                active.clear();
+                for (int i = 1; i < n; i++)
+                {
+                    activate(i);
+                }
+
+                while (!active.empty())
+                {
+                    int a = active.front();
+                    active.pop_front();
+                    queued[a] = 0;
+
+                    while (tryTwoOpt(a) || tryOrOpt(a))
+                    {
+                    }
+                }
+            }
+
+            // Read the cycle starting after the depot
+            for (int p = 1; p < n; p++)
+            {
+                route[p - 1] = ids[tour[(position[0] + p) % n]];
+            }
+            return calculateTotalDistance(locations, route);
+        }
+
+    private:
+        // Timing of a stretch of consecutive stops: arriving at the first stop at time t is
+        // feasible iff t <= latestArrival, and the last stop is then left at
+        // max(t + duration, earliestDeparture)
+        struct ScheduleSegment
+        {
+            int first, last;
+            int duration;
+            int earliestDeparture;
+            int latestArrival;
+        };
+
+        static constexpr double EPSILON = 1e-9;
+        static const int MAX_SEGMENT = 3;
+        static const int OPEN_WINDOW = 1000000000; // The vehicle may return to the depot at any time
+        static const int NEVER = -1000000000;
+
+        const std::vector<Location> &locations;
+        int k;
+        bool useTimeWindows;
+        bool checkTimeWindows = false;
+
+        int n = 0;                   // Depot plus stops; dense index 0 is the depot
+        std::vector<int> ids;        // Location id of each dense index
+        std::vector<int> candidates; // candidates[i * k + j] = j-th nearest to i
+        std::vector<int> tour;       // tour[p] = dense index at position p
+        std::vector<int> position;
+        std::vector<char> queued;
+        std::deque<int> active;
+        std::vector<ScheduleSegment> prefix, suffix; // Route up to / from each position
+
+        const Location &at(int i) const { return locations[ids[i]]; }
+        double dist(int a, int b) const { return distance(at(a), at(b)); }
+
+        int next(int c) const { return tour[position[c] + 1 == n ? 0 : position[c] + 1]; }
+        int prev(int c) const { return tour[position[c] == 0 ? n - 1 : position[c] - 1]; }
+
+        int forwardSteps(int a, int b) const
+        {
+            int steps = position[b] - position[a];
+            return steps < 0 ? steps + n : steps;
+        }
+
+        void activate(int c)
+        {
+            if (c != 0 && !queued[c])
+            {
+                queued[c] = 1;
+                active.push_back(c);
+            }
+        }
+
+        // k nearest stops (or the depot) of every dense index, from a uniform grid
+        void buildCandidates()
+        {
+            k = std::min(k, n - 1);
+            double minX = at(0).x, maxX = minX, minY = at(0).y, maxY = minY;
+            for (int i = 1; i < n; i++)
+            {
+                minX = std::min(minX, at(i).x);
+                maxX = std::max(maxX, at(i).x);
+                minY = std::min(minY, at(i).y);
+                maxY = std::max(maxY, at(i).y);
+            }
+            double cellSize = std::max({maxX - minX, maxY - minY, 1e-9}) / std::max(1.0, std::sqrt(n / 2.0));
+            int width = static_cast<int>((maxX - minX) / cellSize) + 1;
+            int height = static_cast<int>((maxY - minY) / cellSize) + 1;
+            auto cellX = [&](int i) { return std::min(width - 1, static_cast<int>((at(i).x - minX) / cellSize)); };
+            auto cellY = [&](int i) { return std::min(height - 1, static_cast<int>((at(i).y - minY) / cellSize)); };
+
+            std::vector<int> cellStart(static_cast<size_t>(width) * height + 1, 0), cellItems(n);
+            for (int i = 0; i < n; i++)
+            {
+                cellStart[static_cast<size_t>(cellY(i)) * width + cellX(i) + 1]++;
+            }
+            std::partial_sum(cellStart.begin(), cellStart.end(), cellStart.begin());
+            std::vector<int> fill(cellStart.begin(), cellStart.end() - 1);
+            for (int i = 0; i < n; i++)
+            {
+                cellItems[fill[static_cast<size_t>(cellY(i)) * width + cellX(i)]++] = i;
+            }
+
+            candidates.resize(static_cast<size_t>(n) * k);
+            std::vector<std::pair<double, int>> heap; // Max-heap of (distance, index)
+            for (int i = 0; i < n; i++)
+            {
+                heap.clear();
+                int cx = cellX(i), cy = cellY(i);
+                for (int ring = 0; ring <= std::max(width, height); ring++)
+                {
+                    for (int y = cy - ring; y <= cy + ring; y++)
+                    {
+                        for (int x = cx - ring; x <= cx + ring; x++)
+                        {
+                            // Only the border of the ring is new
+                            if (x < 0 || y < 0 || x >= width || y >= height ||
+                                (std::abs(x - cx) != ring && std::abs(y - cy) != ring))
+                            {
+                                continue;
+                            }
+                            size_t cell = static_cast<size_t>(y) * width + x;
+                            for (int p = cellStart[cell]; p < cellStart[cell + 1]; p++)
+                            {
+                                int j = cellItems[p];
+                                double d = j == i ? 0 : dist(i, j);
+                                if (j == i || (static_cast<int>(heap.size()) == k && d >= heap.front().first))
+                                {
+                                    continue;
+                                }
+                                if (static_cast<int>(heap.size()) == k)
+                                {
+                                    std::pop_heap(heap.begin(), heap.end());
+                                    heap.pop_back();
+                                }
+                                heap.push_back({d, j});
+                                std::push_heap(heap.begin(), heap.end());
+                            }
+                        }
+                    }
+
+                    // Unscanned points are at least ring * cellSize away
+                    if (static_cast<int>(heap.size()) == k && heap.front().first <= ring * cellSize)
+                    {
+                        break;
+                    }
+                }
+                std::sort_heap(heap.begin(), heap.end());
+                for (int j = 0; j < k; j++)
+                {
+                    candidates[static_cast<size_t>(i) * k + j] = heap[j].second;
+                }
+            }
+        }
+
+        ScheduleSegment single(int i) const
+        {
+            const Location &loc = at(i);
+            return {i, i, loc.serviceTime, loc.earliestArrival + loc.serviceTime, loc.latestArrival};
+        }
+
+        ScheduleSegment concat(const ScheduleSegment &a, const ScheduleSegment &b) const
+        {
+            int travel = static_cast<int>(dist(a.last, b.first));
+            ScheduleSegment result;
+            result.first = a.first;
+            result.last = b.last;
+            result.duration = a.duration + travel + b.duration;
+            result.earliestDeparture = std::max(a.earliestDeparture + travel + b.duration, b.earliestDeparture);
+            result.latestArrival = a.earliestDeparture + travel > b.latestArrival
+                                       ? NEVER
+                                       : std::min(a.latestArrival, b.latestArrival - a.duration - travel);
+            return result;
+        }
+
+        // Append the stops at positions from..to (stepping backwards if from > to)
+        ScheduleSegment extend(ScheduleSegment segment, int from, int to) const
+        {
+            int step = from <= to ? 1 : -1;
+            for (int p = from; p != to + step; p += step)
+            {
+                segment = concat(segment, single(tour[p]));
+            }
+            return segment;
+        }
+
+        // The route leaves the depot at time 0
+        static bool startsOnTime(const ScheduleSegment &route) { return route.latestArrival >= 0; }
+
+        bool scheduleFeasible()
+        {
+            prefix.resize(n);
+            suffix.resize(n + 1);
+            prefix[0] = single(0);
+            for (int p = 1; p < n; p++)
+            {
+                prefix[p] = concat(prefix[p - 1], single(tour[p]));
+            }
+            suffix[n] = {0, 0, 0, at(0).earliestArrival, OPEN_WINDOW};
+            for (int p = n - 1; p >= 1; p--)
+            {
+                suffix[p] = concat(single(tour[p]), suffix[p + 1]);
+            }
+            return startsOnTime(concat(prefix[n - 1], suffix[n]));
+        }
+
+        // Positions of the path from a forward to b, or of the rest of the cycle if the
+        // path contains the depot
+        std::pair<int, int> sideWithoutDepot(int a, int b) const
+        {
+            if (position[a] != 0 && position[a] <= position[b])
+            {
+                return {position[a], position[b]};
+            }
+            return {position[next(b)], position[prev(a)]};
+        }
+
+        // Reverse the path from a forward to b; without time windows the shorter side of the
+        // cycle is reversed, with them the side without the depot
+        void reversePath(int a, int b)
+        {
+            int i, j, inner;
+            if (checkTimeWindows)
+            {
+                std::tie(i, j) = sideWithoutDepot(a, b);
+                inner = j - i + 1;
+            }
+            else
+            {
+                inner = forwardSteps(a, b) + 1;
+                if (2 * inner > n)
+                {
+                    int outerStart = next(b);
+                    b = prev(a);
+                    a = outerStart;
+                    inner = n - inner;
+                }
+                i = position[a];
+                j = position[b];
+            }
+
+            for (int swaps = inner / 2; swaps > 0; swaps--)
+            {
+                std::swap(tour[i], tour[j]);
+                position[tour[i]] = i;
+                position[tour[j]] = j;
+                i = i + 1 == n ? 0 : i + 1;
+                j = j == 0 ? n - 1 : j - 1;
+            }
+        }
+
+        // Replace edges (t1, t2), (t3, t4) - t2 after t1 and t4 after t3 in one direction - by (t1, t3), (t2, t4)
+        void twoOptMove(int t1, int t2, int t3, int t4)
+        {
+            if (next(t1) == t2)
+            {
+                reversePath(t2, t3);
+            }
+            else
+            {
+                reversePath(t1, t4);
+            }
+        }
+
+        bool tryTwoOpt(int a)
+        {
+            for (int direction = 0; direction < 2; direction++)
+            {
+                int b = direction == 0 ? next(a) : prev(a);
+                double removed = dist(a, b);
+
+                for (int j = 0; j < k; j++)
+                {
+                    int c = candidates[static_cast<size_t>(a) * k + j];
+                    double added = dist(a, c);
+                    if (added >= removed - EPSILON)
+                    {
+                        break;
+                    }
+
+                    int d = direction == 0 ? next(c) : prev(c);
+                    if (c == b || d == a || added + dist(b, d) - removed - dist(c, d) >= -EPSILON)
+                    {
+                        continue;
+                    }
+
+                    if (checkTimeWindows)
+                    {
+                        auto [i, last] = direction == 0 ? sideWithoutDepot(b, c) : sideWithoutDepot(a, d);
+                        if (!startsOnTime(concat(extend(prefix[i - 1], last, i), suffix[last + 1])))
+                        {
+                            continue;
+                        }
+                    }
+
+                    twoOptMove(a, b, c, d);
+                    for (int city : {a, b, c, d})
+                    {
+                        activate(city);
+                    }
+                    if (checkTimeWindows)
+                    {
+                        scheduleFeasible();
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Move first..last (tour order) between x and y = next(x)
+        void moveSegment(int first, int last, int x, int y, bool reversed)
+        {
+            if (checkTimeWindows)
+            {
+                // Shift the stops in between so the depot stays at position 0
+                int i = position[first], j = position[last], q = position[x];
+                int lo = std::min(i, q + 1), hi = std::max(j, q);
+                if (q > j)
+                {
+                    std::rotate(tour.begin() + i, tour.begin() + j + 1, tour.begin() + q + 1);
+                    i = q - (j - i);
+                    j = q;
+                }
+                else
+                {
+                    std::rotate(tour.begin() + q + 1, tour.begin() + i, tour.begin() + j + 1);
+                    j = q + 1 + (j - i);
+                    i = q + 1;
+                }
+                if (reversed)
+                {
+                    std::reverse(tour.begin() + i, tour.begin() + j + 1);
+                }
+                for (int p = lo; p <= hi; p++)
+                {
+                    position[tour[p]] = p;
+                }
+                return;
+            }
+
+            int before = prev(first), after = next(last);
+
+            // before [first..last] after ... x y  ->  before x ... after [last..first] y
+            twoOptMove(before, first, x, y);
+            // -> before after ... x [last..first] y
+            if (x != after)
+            {
+                twoOptMove(before, x, after, last);
+            }
+            // -> x [first..last] y
+            if (!reversed && first != last)
+            {
+                twoOptMove(x, last, first, y);
+            }
+        }
+
+        // Schedule after moving positions i..j between x and y = next(x), nearX next to x
+        bool orOptFeasible(int i, int j, int x, int nearX) const
+        {
+            int from = nearX == tour[i] ? i : j, to = nearX == tour[i] ? j : i;
+            int q = position[x];
+            if (q > j)
+            {
+                // ... before after ... x [segment] y ...
+                ScheduleSegment route = extend(extend(prefix[i - 1], j + 1, q), from, to);
+                return startsOnTime(concat(route, suffix[q + 1]));
+            }
+            // ... x [segment] y ... before after ...
+            ScheduleSegment route = extend(extend(prefix[q], from, to), q + 1, i - 1);
+            return startsOnTime(concat(route, suffix[j + 1]));
+        }
+
+        bool tryOrOpt(int a)
+        {
+            for (int length = 1; length <= MAX_SEGMENT && length < n - 2; length++)
+            {
+                for (int direction = 0; direction < (length == 1 ? 1 : 2); direction++)
+                {
+                    // Segment with a at one end
+                    int first = a, last = a;
+                    for (int step = 1; step < length; step++)
+                    {
+                        if (direction == 0)
+                        {
+                            last = next(last);
+                        }
+                        else
+                        {
+                            first = prev(first);
+                        }
+                    }
+
+                    // The depot never moves when time windows are checked
+                    if (checkTimeWindows && (position[first] == 0 || position[first] > position[last]))
+                    {
+                        continue;
+                    }
+
+                    int before = prev(first), after = next(last);
+                    double removalGain = dist(before, first) + dist(last, after) - dist(before, after);
+                    int other = a == first ? last : first;
+
+                    for (int j = 0; j < k; j++)
+                    {
+                        int c = candidates[static_cast<size_t>(a) * k + j];
+                        if (dist(a, c) >= removalGain - EPSILON)
+                        {
+                            break;
+                        }
+                        if (forwardSteps(first, c) < length)
+                        {
+                            continue;
+                        }
+
+                        // Put a next to c, after it or before it
+                        for (int side = 0; side < 2; side++)
+                        {
+                            int x = side == 0 ? c : prev(c);
+                            int y = side == 0 ? next(c) : c;
+                            if (x == last || y == first || y == before)
+                            {
+                                continue;
+                            }
+
+                            int nearX = side == 0 ? a : other;
+                            int nearY = side == 0 ? other : a;
+                            if (dist(x, nearX) + dist(nearY, y) - dist(x, y) - removalGain >= -EPSILON)
+                            {
+                                continue;
+                            }
+                            if (checkTimeWindows && !orOptFeasible(position[first], position[last], x, nearX))
+                            {
+                                continue;
+                            }
+
+                            moveSegment(first, last, x, y, nearX != first);
+                            for (int city : {before, after, first, last, x, y})
+                            {
+                                activate(city);
+                            }
+                            if (checkTimeWindows)
+                            {
+                                scheduleFeasible();
+                            }
+                            return true;
+                        }
+                    }
+                }
+            }
+            return false;
+        }
+    };
+
     // Generate a random problem instance
     std::vector<Location> generateRandomProblem(int numLocations, double areaSize = 100.0,
                                                 int maxWeight = 10, int timeWindowWidth = 30)
@@ -1293,6 +1797,14 @@ namespace RouteOptimization
 
         std::cout << "\nImprovement: " << std::fixed << std::setprecision(2)
                   << improvement << "%\n";
+
+        // Polish with neighbor-list 2-opt / Or-opt (keeps a feasible schedule feasible)
+        std::vector<int> polishedRoute = optimizedSolution.locationOrder;
+        RouteLocalSearch(locations).improve(polishedRoute);
+        Route polishedSolution = evaluateRoute(locations, polishedRoute, vehicleCapacity);
+
+        std::cout << "After 2-opt / Or-opt local search - Distance: " << polishedSolution.totalDistance
+                  << ", Feasible: " << (polishedSolution.feasible ? "Yes" : "No") << "\n";
     }
 
     // Run route optimization benchmark with different problem sizes
@@ -1353,6 +1865,65 @@ namespace RouteOptimization
             std::cout << "Optimized solution - Distance: " << optimizedSolution.totalDistance
                       << ", Feasible: " << (optimizedSolution.feasible ? "Yes" : "No") << "\n";
         }
+
+        std::cout << "\n=== ROUTE LOCAL SEARCH BENCHMARK ===\n";
+
+        for (int size : {1000, 10000, 100000})
+        {
+            std::cout << "\nProblem size: " << size << " locations\n";
+
+            // Open time windows and a vehicle that fits everything, so only distance matters
+            std::vector<Location> locations = generateRandomProblem(size, 1000.0, 10, 480);
+            int capacity = 10 * size;
+
+            auto report = [&](const std::string &name, std::chrono::microseconds time, const std::vector<int> &route)
+            {
+                std::cout << std::left << std::setw(30) << name << std::right
+                          << std::setw(12) << std::fixed << std::setprecision(2) << time.count() / 1000.0 << " ms"
+                          << "   distance " << calculateTotalDistance(locations, route) << "\n";
+            };
+
+            // Strip start: horizontal strips, visited left to right and right to left in turn
+            auto start = std::chrono::high_resolution_clock::now();
+            std::vector<int> stripRoute(size);
+            std::iota(stripRoute.begin(), stripRoute.end(), 1);
+            int strips = std::max(1, static_cast<int>(std::sqrt(size / 2.0)));
+            auto strip = [&](int id)
+            { return std::min(strips - 1, static_cast<int>(locations[id].y / 1000.0 * strips)); };
+            std::sort(stripRoute.begin(), stripRoute.end(), [&](int a, int b)
+                      {
+                if (strip(a) != strip(b))
+                {
+                    return strip(a) < strip(b);
+                }
+                return strip(a) % 2 == 0 ? locations[a].x < locations[b].x : locations[a].x > locations[b].x; });
+            auto end = std::chrono::high_resolution_clock::now();
+            report("Strip start", getElapsedMicroseconds(start, end), stripRoute);
+
+            start = std::chrono::high_resolution_clock::now();
+            RouteLocalSearch(locations).improve(stripRoute);
+            end = std::chrono::high_resolution_clock::now();
+            report("Strip + 2-opt / Or-opt", getElapsedMicroseconds(start, end), stripRoute);
+
+            // The greedy start and annealing rescan whole routes at every step
+            if (size <= 10000)
+            {
+                start = std::chrono::high_resolution_clock::now();
+                std::vector<int> greedyRoute = createInitialSolution(locations, capacity);
+                end = std::chrono::high_resolution_clock::now();
+                report("Greedy start", getElapsedMicroseconds(start, end), greedyRoute);
+
+                start = std::chrono::high_resolution_clock::now();
+                Route annealed = optimizeRoute(locations, capacity);
+                end = std::chrono::high_resolution_clock::now();
+                report("Simulated annealing (10000)", getElapsedMicroseconds(start, end), annealed.locationOrder);
+
+                start = std::chrono::high_resolution_clock::now();
+                RouteLocalSearch(locations).improve(greedyRoute);
+                end = std::chrono::high_resolution_clock::now();
+                report("Greedy + 2-opt / Or-opt", getElapsedMicroseconds(start, end), greedyRoute);
+            }
+        }
     }
 }
 
@@ -1344,20 +1344,26 @@ namespace AdvancedTechniques
         }
 
         /**
-         * @brief Find the root of element x (with path compression)
+         * @brief Find the root of element x (with path splitting)
          * @param x Element to find
          * @return Root of x
          *
+         * Path splitting points every visited node at its grandparent. It gives the same
+         * bound as recursive path compression but runs in a loop, so long chains built
+         * before the first find cannot overflow the call stack.
+         *
          * Time Complexity: O(α(n)) where α is the inverse Ackermann function (nearly constant)
          * Space Complexity: O(1)
          */
         int find(int x)
         {
-            if (parent[x] != x)
+            while (parent[x] != x)
             {
-                parent[x] = find(parent[x]); // Path compression
+                int next = parent[x];
+                parent[x] = parent[next];
+                x = next;
             }
-            return parent[x];
+            return x;
         }
 
         /**